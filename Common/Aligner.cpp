@@ -1,205 +1,266 @@
-/*
- * Common : a collection of classes (re)used throughout the scaffolder implementation.
- * Copyright (C) 2011  Alexey Gritsenko
- * 
- * This program is free software: you can redistribute it and/or modify
- * it under the terms of the GNU General Public License as published by
- * the Free Software Foundation, either version 3 of the License, or
- * (at your option) any later version.
- *
- * This program is distributed in the hope that it will be useful,
- * but WITHOUT ANY WARRANTY; without even the implied warranty of
- * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- * GNU General Public License for more details.
- *
- * You should have received a copy of the GNU General Public License
- * along with this program.  If not, see http://www.gnu.org/licenses/.
- * 
- * 
- * 
- * Email: a.gritsenko@tudelft.nl
- * Mail: Delft University of Technology
- *       Faculty of Electrical Engineering, Mathematics, and Computer Science
- *       Department of Mediamatics
- *       P.O. Box 5031
- *       2600 GA, Delft, The Netherlands
- */
-
-
-#include "Aligner.h"
-#include "Helpers.h"
-#include "Globals.h"
-
-// Base class destructor (removes alignment file).
-Aligner::~Aligner()
-{
-    if (RemoveOutput && OutputFileName.length() > 0)
-        Helpers::RemoveFile(OutputFileName);
-}
-
-// BWA Aligner ctor
-BWAAligner::BWAAligner(const string &referenceFile, const string &queryFile, const BWAConfiguration &config)
-	: Aligner(referenceFile, queryFile), Configuration(config)
-{
-	IndexFileExtensions.push_back(".amb");
-	IndexFileExtensions.push_back(".ann");
-	IndexFileExtensions.push_back(".bwt");
-	IndexFileExtensions.push_back(".pac");
-	IndexFileExtensions.push_back(".rbwt");
-	IndexFileExtensions.push_back(".rpac");
-	IndexFileExtensions.push_back(".rsa");
-	IndexFileExtensions.push_back(".sa");
-}
-
-// Alignes query to reference using single end BWA alignement. Returns true if successful.
-bool BWAAligner::Align(const string &outFile)
-{
-	char str[MaxLine];
-	bool success = true;
-	OutputFileName.clear();
-
-	string prefix, outSai;
-	prefix = Helpers::TempFile(Configuration.TmpPath);
-	sprintf(str, Configuration.IndexCommand.c_str(), prefix.c_str(), ReferenceFileName.c_str());
-	if (!Helpers::Execute(str))
-		success = false;
-	if (success)
-	{
-		outSai = Helpers::TempFile(Configuration.TmpPath);
-		if (Configuration.ExactMatch)
-			sprintf(str, Configuration.SuffixArrayExactCommand.c_str(), Configuration.NumberOfThreads, outSai.c_str(), prefix.c_str(), QueryFileName.c_str());
-		else
-			sprintf(str, Configuration.SuffixArrayCommand.c_str(), Configuration.NumberOfThreads, outSai.c_str(), prefix.c_str(), QueryFileName.c_str());
-		if (!Helpers::Execute(str))
-			success = false;
-	}
-	if (success)
-	{
-		OutputFileName = (outFile.length() > 0 ? outFile : Helpers::TempFile(Configuration.TmpPath));
-		sprintf(str, Configuration.AlignSingleEndCommand.c_str(), OutputFileName.c_str(), Configuration.MaximumHits + 1, prefix.c_str(), outSai.c_str(), QueryFileName.c_str());
-		if (!Helpers::Execute(str))
-			success = false;
-	}
-
-	removeIndexFiles(prefix);
-	if (outSai.length() > 0)
-		Helpers::RemoveFile(outSai);
-	if (!success && OutputFileName.length() > 0)
-	{
-		Helpers::RemoveFile(OutputFileName);
-		OutputFileName.clear();
-	}
-
-	return success;
-}
-
-// Removes index files of BWA aligner with given prefix
-void BWAAligner::removeIndexFiles(const string &prefix)
-{
-	int nSuffix = IndexFileExtensions.size();
-	for (int i = 0; i < nSuffix; i++)
-		Helpers::RemoveFile(prefix + IndexFileExtensions[i]);
-}
-
-vector<string> BWAAligner::IndexFileExtensions;
-
-// Alignes query to reference using single end NovoAlign alignement. Returns true if successful.
-bool NovoAlignAligner::Align(const string &outFile)
-{
-	char str[MaxLine];
-	bool success = true;
-	OutputFileName.clear();
-
-	string prefix;
-	prefix = Helpers::TempFile(Configuration.TmpPath);
-	sprintf(str, Configuration.IndexCommand.c_str(), prefix.c_str(), ReferenceFileName.c_str());
-	if (!Helpers::Execute(str))
-		success = false;
-	if (success)
-	{
-		OutputFileName = (outFile.length() > 0 ? outFile : Helpers::TempFile(Configuration.TmpPath));
-		sprintf(str, Configuration.AlignSingleEndCommand.c_str(), prefix.c_str(), QueryFileName.c_str(), OutputFileName.c_str());
-		if (!Helpers::Execute(str))
-                    success = false;
-	}
-
-	Helpers::RemoveFile(prefix);
-	if (!success)
-	{
-		Helpers::RemoveFile(OutputFileName);
-		OutputFileName.clear();
-	}
-
-	return success;
-}
-
-// Aligns query to reference using MUMMER package. Returns true if successful.
-bool MummerAligner::Align(const string &outFile)
-{
-    char str[MaxLine];
-    bool success = true;
-    OutputFileName.clear();
-
-    string prefix = Helpers::TempFile(Configuration.TmpPath);
-    string delta = Helpers::TempFile(Configuration.TmpPath);
-    
-    sprintf(str, Configuration.NucmerCommand.c_str(), prefix.c_str(), ReferenceFileName.c_str(), QueryFileName.c_str());
-    if (!Helpers::Execute(str))
-        success = false;
-    if (success)
-    {
-        sprintf(str, Configuration.DeltaFilterCommand.c_str(), (prefix + ".delta").c_str(), delta.c_str());
-        if (!Helpers::Execute(str))
-            success = false;
-    }
-    if (success)
-    {
-        OutputFileName = (outFile.length() > 0 ? outFile : Helpers::TempFile(Configuration.TmpPath));
-        sprintf(str, Configuration.ShowCoordsCommand.c_str(), delta.c_str(), OutputFileName.c_str());
-        //sprintf(str, Configuration.ShowCoordsCommand.c_str(), (prefix + ".delta").c_str(), OutputFileName.c_str());
-        if (!Helpers::Execute(str))
-            success = false;
-    }
-
-    Helpers::RemoveFile(prefix + ".delta");
-    Helpers::RemoveFile(delta);
-    //cout << "Delta: " << prefix + ".delta" << endl;
-    //cout << "Delta-filtered: " << delta << endl;
-    if (!success)
-    {
-        Helpers::RemoveFile(OutputFileName);
-        OutputFileName.clear();
-    }
-
-    return success;
-}
-
-// Aligns query to reference using MUMMER package and creates a tiling. Returns true if successful.
-bool MummerTiler::Align(const string &outFile)
-{
-    char str[MaxLine];
-    bool success = true;
-    OutputFileName.clear();
-
-    string prefix = Helpers::TempFile(Configuration.TmpPath);
-    
-    sprintf(str, Configuration.NucmerCommand.c_str(), prefix.c_str(), ReferenceFileName.c_str(), QueryFileName.c_str());
-    if (!Helpers::Execute(str))
-        success = false;
-    if (success)
-    {
-        OutputFileName = (outFile.length() > 0 ? outFile : Helpers::TempFile(Configuration.TmpPath));
-        sprintf(str, Configuration.ShowTilingCommand.c_str(), (prefix + ".delta").c_str(), OutputFileName.c_str());
-        if (!Helpers::Execute(str))
-            success = false;
-    }
-
-    Helpers::RemoveFile(prefix + ".delta");
-    if (!success)
-    {
-        Helpers::RemoveFile(OutputFileName);
-        OutputFileName.clear();
-    }
-
-    return success;
-}
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+
+#include "Aligner.h"
+#include "Helpers.h"
+#include "Globals.h"
+#include "ScratchSpace.h"
+#include <iostream>
+
+// Base class destructor (removes alignment file and files left behind by a stream).
+Aligner::~Aligner()
+{
+    if (RemoveOutput && OutputFileName.length() > 0)
+        Helpers::RemoveFile(OutputFileName);
+    cleanUp();
+}
+
+// Aligners that cannot produce SAM on stdout do not stream.
+bool Aligner::PrepareStream(ProcessJob &)
+{
+	return false;
+}
+
+// Runs an external program with stderr discarded and stdout either discarded or written to outFile.
+bool Aligner::run(ProcessJob &job, const string &outFile)
+{
+	job.Stdout = (outFile.length() > 0 ? FileOutput : DiscardOutput);
+	job.StdoutFile = outFile;
+	job.Stderr = DiscardOutput;
+	bool result = ProcessRunner::Execute(job);
+	Stats.push_back(job.Stats);
+	return result;
+}
+
+// Align for streaming aligners: runs the prepared SAM producing step into the output file.
+bool Aligner::alignPrepared(const string &outFile, const string &tmpPath)
+{
+	OutputFileName.clear();
+	ProcessJob job;
+	bool success = PrepareStream(job);
+	if (success)
+	{
+		OutputFileName = (outFile.length() > 0 ? outFile : ScratchSpace::CreateFile(tmpPath));
+		success = run(job, OutputFileName);
+	}
+
+	cleanUp();
+	if (!success && OutputFileName.length() > 0)
+	{
+		Helpers::RemoveFile(OutputFileName);
+		OutputFileName.clear();
+	}
+	return success;
+}
+
+// Finds or builds the reference index. With a cache path the index is shared through
+// the cache, otherwise, or when the cache cannot be used, it is built under a temporary
+// prefix and removed by cleanUp.
+bool Aligner::indexReference(const string &cachePath, long long cacheSize, const string &tmpPath, const string &signature, const vector<string> &suffixes, const function<bool (const string &)> &build, string &prefix)
+{
+	if (cachePath.length() > 0)
+	{
+		IndexCache cache(cachePath, cacheSize);
+		bool buildFailed = false;
+		auto cachedBuild = [&build, &buildFailed](const string &indexPrefix)
+		{
+			buildFailed = !build(indexPrefix);
+			return !buildFailed;
+		};
+		if (cache.Acquire(ReferenceFileName, signature, cachedBuild, index))
+		{
+			prefix = index.Prefix;
+			return true;
+		}
+		// a failing indexer would fail again, anything else is a problem of the cache itself
+		if (buildFailed)
+			return false;
+		cerr << "[-] Unable to use index cache " << cachePath << ", building the index without it." << endl;
+	}
+
+	prefix = ScratchSpace::CreatePrefix(tmpPath);
+	for (size_t i = 0; i < suffixes.size(); i++)
+		temporaryFiles.push_back(prefix + suffixes[i]);
+	return build(prefix);
+}
+
+void Aligner::cleanUp()
+{
+	for (size_t i = 0; i < temporaryFiles.size(); i++)
+		Helpers::RemoveFile(temporaryFiles[i]);
+	temporaryFiles.clear();
+	index.Release();
+}
+
+// BWA Aligner ctor
+BWAAligner::BWAAligner(const string &referenceFile, const string &queryFile, const BWAConfiguration &config)
+	: Aligner(referenceFile, queryFile), Configuration(config)
+{
+	if (!IndexFileExtensions.empty())
+		return;
+	IndexFileExtensions.push_back(".amb");
+	IndexFileExtensions.push_back(".ann");
+	IndexFileExtensions.push_back(".bwt");
+	IndexFileExtensions.push_back(".pac");
+	IndexFileExtensions.push_back(".rbwt");
+	IndexFileExtensions.push_back(".rpac");
+	IndexFileExtensions.push_back(".rsa");
+	IndexFileExtensions.push_back(".sa");
+}
+
+// Alignes query to reference using single end BWA alignement. Returns true if successful.
+bool BWAAligner::Align(const string &outFile)
+{
+	return alignPrepared(outFile, Configuration.TmpPath);
+}
+
+// Gets the (cached) index and builds the suffix array coordinates, samse is left to the caller.
+bool BWAAligner::PrepareStream(ProcessJob &job)
+{
+	Stats.clear();
+	cleanUp();
+
+	string prefix;
+	auto build = [this](const string &indexPrefix)
+	{
+		ProcessJob index(Configuration.Executable, { "index", "-a", "is", "-p", indexPrefix, ReferenceFileName });
+		return run(index);
+	};
+	if (!indexReference(Configuration.IndexCachePath, Configuration.IndexCacheSize, Configuration.TmpPath, Configuration.Executable + " index -a is", IndexFileExtensions, build, prefix))
+		return false;
+
+	string outSai = ScratchSpace::CreateFile(Configuration.TmpPath);
+	temporaryFiles.push_back(outSai);
+	ProcessJob aln(Configuration.Executable, { "aln", "-t" });
+	aln.Add(Configuration.NumberOfThreads).Add("-f").Add(outSai).Add(prefix).Add(QueryFileName);
+	if (!run(aln))
+		return false;
+
+	job = ProcessJob(Configuration.Executable, { "samse", "-n" });
+	job.Add(Configuration.MaximumHits + 1).Add(prefix).Add(outSai).Add(QueryFileName);
+	job.Stderr = DiscardOutput;
+	return true;
+}
+
+vector<string> BWAAligner::IndexFileExtensions;
+
+// Alignes query to reference using single end NovoAlign alignement. Returns true if successful.
+bool NovoAlignAligner::Align(const string &outFile)
+{
+	return alignPrepared(outFile, Configuration.TmpPath);
+}
+
+// Gets the (cached) index, the alignment itself is left to the caller.
+bool NovoAlignAligner::PrepareStream(ProcessJob &job)
+{
+	Stats.clear();
+	cleanUp();
+
+	string prefix;
+	auto build = [this](const string &indexPrefix)
+	{
+		ProcessJob index(Configuration.IndexExecutable, { "-m", indexPrefix, ReferenceFileName });
+		return run(index);
+	};
+	if (!indexReference(Configuration.IndexCachePath, Configuration.IndexCacheSize, Configuration.TmpPath, Configuration.IndexExecutable + " -m", vector<string>(1, ""), build, prefix))
+		return false;
+
+	job = ProcessJob(Configuration.AlignExecutable, { "-d", prefix, "-f", QueryFileName, "-o", "SAM", "-r", "All" });
+	job.Stderr = DiscardOutput;
+	return true;
+}
+
+// Aligns query to reference using MUMMER package. Returns true if successful.
+bool MummerAligner::Align(const string &outFile)
+{
+    bool success = true;
+    OutputFileName.clear();
+    Stats.clear();
+
+    string prefix = ScratchSpace::CreatePrefix(Configuration.TmpPath);
+    string delta = ScratchSpace::CreateFile(Configuration.TmpPath);
+    
+    ProcessJob nucmer(Configuration.NucmerExecutable, { "-p", prefix, ReferenceFileName, QueryFileName });
+    if (!run(nucmer))
+        success = false;
+    if (success)
+    {
+        ProcessJob filter(Configuration.DeltaFilterExecutable, { "-q", prefix + ".delta" });
+        if (!run(filter, delta))
+            success = false;
+    }
+    if (success)
+    {
+        OutputFileName = (outFile.length() > 0 ? outFile : ScratchSpace::CreateFile(Configuration.TmpPath));
+        ProcessJob coords(Configuration.ShowCoordsExecutable, { "-q", "-T", "-d", "-H", delta });
+        if (!run(coords, OutputFileName))
+            success = false;
+    }
+
+    Helpers::RemoveFile(prefix + ".delta");
+    Helpers::RemoveFile(delta);
+    //cout << "Delta: " << prefix + ".delta" << endl;
+    //cout << "Delta-filtered: " << delta << endl;
+    if (!success)
+    {
+        Helpers::RemoveFile(OutputFileName);
+        OutputFileName.clear();
+    }
+
+    return success;
+}
+
+// Aligns query to reference using MUMMER package and creates a tiling. Returns true if successful.
+bool MummerTiler::Align(const string &outFile)
+{
+    bool success = true;
+    OutputFileName.clear();
+    Stats.clear();
+
+    string prefix = ScratchSpace::CreatePrefix(Configuration.TmpPath);
+    
+    ProcessJob nucmer(Configuration.NucmerExecutable, { "-p", prefix, ReferenceFileName, QueryFileName });
+    if (!run(nucmer))
+        success = false;
+    if (success)
+    {
+        OutputFileName = (outFile.length() > 0 ? outFile : ScratchSpace::CreateFile(Configuration.TmpPath));
+        ProcessJob tiling(Configuration.ShowTilingExecutable, { prefix + ".delta" });
+        if (!run(tiling, OutputFileName))
+            success = false;
+    }
+
+    Helpers::RemoveFile(prefix + ".delta");
+    if (!success)
+    {
+        Helpers::RemoveFile(OutputFileName);
+        OutputFileName.clear();
+    }
+
+    return success;
+}
@@ -1,63 +1,78 @@
-/*
- * Common : a collection of classes (re)used throughout the scaffolder implementation.
- * Copyright (C) 2011  Alexey Gritsenko
- * 
- * This program is free software: you can redistribute it and/or modify
- * it under the terms of the GNU General Public License as published by
- * the Free Software Foundation, either version 3 of the License, or
- * (at your option) any later version.
- *
- * This program is distributed in the hope that it will be useful,
- * but WITHOUT ANY WARRANTY; without even the implied warranty of
- * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- * GNU General Public License for more details.
- *
- * You should have received a copy of the GNU General Public License
- * along with this program.  If not, see http://www.gnu.org/licenses/.
- * 
- * 
- * 
- * Email: a.gritsenko@tudelft.nl
- * Mail: Delft University of Technology
- *       Faculty of Electrical Engineering, Mathematics, and Computer Science
- *       Department of Mediamatics
- *       P.O. Box 5031
- *       2600 GA, Delft, The Netherlands
- */
-
-
-#ifndef _ALIGNMENTREADER_H
-#define _ALIGNMENTREADER_H
-
-#include <iostream>
-#include "api/BamReader.h"
-#include "XATag.h"
-
-using namespace std;
-using namespace BamTools;
-
-class AlignmentReader
-{
-public:
-	AlignmentReader();
-
-public:
-	bool Open(const string &fileName);
-	bool Close();
-	bool IsOpen() const;
-	bool GetNextAlignmentGroup(vector<BamAlignment> &alg);
-	bool GetNextAlignmentGroup(BamAlignment &alignment, vector<XATag> &tags);
-        
-public:
-    const RefVector & GetReferences() const;
-    int GetReferenceCount() const;
-
-private:
-	void parseXATag(const string &str, vector<XATag> &tags);
-	XATag parseXAEntry(const string &str);
-
-private:
-	BamReader reader;
-	BamAlignment buffer;
-};
-#endif
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+
+#ifndef _ALIGNMENTREADER_H
+#define _ALIGNMENTREADER_H
+
+#include <iostream>
+#include "BamFileReader.h"
+#include "SamReader.h"
+#include "ProcessRunner.h"
+#include "XATag.h"
+#include "NameIndex.h"
+
+using namespace std;
+using namespace BamTools;
+
+class AlignmentReader
+{
+public:
+	AlignmentReader();
+
+public:
+	// threads <= 0 inflates the BAM file on all available cores, bases = false skips
+	// decoding the bases and qualities for callers that only use positions and tags
+	bool Open(const string &fileName, int threads = 0, bool bases = true);
+	// streams SAM from the job's stdout while it runs, the job must outlive Close
+	bool Open(ProcessJob &job);
+	// false if a streaming job failed
+	bool Close();
+	bool IsOpen() const;
+	bool GetNextAlignmentGroup(vector<BamAlignment> &alg);
+	bool GetNextAlignmentGroup(BamAlignment &alignment, vector<XATag> &tags);
+        
+public:
+    const RefVector & GetReferences() const;
+    int GetReferenceCount() const;
+    const NameIndex &GetReferenceIndex() const;
+
+private:
+	bool next(BamAlignment &alg);
+	void indexReferences();
+	void addTags(const BamAlignment &alg, vector<XATag> &tags);
+
+private:
+	BamFileReader reader;
+	SamReader samReader;
+	ProcessPipe pipe;
+	bool streaming;
+	bool bases;
+	BamAlignment buffer;
+	NameIndex references;
+};
+#endif
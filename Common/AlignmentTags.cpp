@@ -0,0 +1,118 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+#include "AlignmentTags.h"
+#include <cstring>
+#include <stdint.h>
+
+using namespace std;
+
+bool AlignmentTags::GetString(const BamAlignment &alg, const char *tag, const char *&value, size_t &length)
+{
+    size_t available;
+    char type;
+    if (!find(alg.TagData, tag, value, available, type) || (type != 'Z' && type != 'H'))
+        return false;
+    const char *end = (const char *)memchr(value, '\0', available);
+    length = (end == NULL ? available : end - value);
+    return true;
+}
+
+bool AlignmentTags::GetInt(const BamAlignment &alg, const char *tag, int &value)
+{
+    const char *data;
+    size_t available;
+    char type;
+    if (!find(alg.TagData, tag, data, available, type) || elementSize(type) > available)
+        return false;
+    switch (type)
+    {
+        case 'c' : value = *(const int8_t *)data;
+            return true;
+        case 'C' : value = *(const uint8_t *)data;
+            return true;
+        case 's' : { int16_t v; memcpy(&v, data, sizeof(v)); value = v; }
+            return true;
+        case 'S' : { uint16_t v; memcpy(&v, data, sizeof(v)); value = v; }
+            return true;
+        case 'i' : { int32_t v; memcpy(&v, data, sizeof(v)); value = v; }
+            return true;
+        case 'I' : { uint32_t v; memcpy(&v, data, sizeof(v)); value = v; }
+            return true;
+        default : return false;
+    }
+}
+
+// Walks the tag list (two character tag, type, value) until the tag is found.
+bool AlignmentTags::find(const string &data, const char *tag, const char *&value, size_t &available, char &type)
+{
+    const char *pos = data.data(), *end = pos + data.size();
+    while (end - pos >= 3)
+    {
+        bool match = pos[0] == tag[0] && pos[1] == tag[1];
+        type = pos[2];
+        pos += 3;
+        if (match)
+        {
+            value = pos;
+            available = end - pos;
+            return true;
+        }
+
+        size_t size = elementSize(type);
+        if (type == 'Z' || type == 'H')
+        {
+            const char *nul = (const char *)memchr(pos, '\0', end - pos);
+            if (nul == NULL)
+                return false;
+            size = nul - pos + 1;
+        }
+        else if (type == 'B')
+        {
+            uint32_t count;
+            if (end - pos < 5 || elementSize(pos[0]) == 0)
+                return false;
+            memcpy(&count, pos + 1, sizeof(count));
+            size = 5 + (size_t)count * elementSize(pos[0]);
+        }
+        if (size == 0 || (size_t)(end - pos) < size)
+            return false;
+        pos += size;
+    }
+    return false;
+}
+
+size_t AlignmentTags::elementSize(char type)
+{
+    switch (type)
+    {
+        case 'A' : case 'c' : case 'C' : return 1;
+        case 's' : case 'S' : return 2;
+        case 'i' : case 'I' : case 'f' : return 4;
+        default : return 0;
+    }
+}
@@ -0,0 +1,190 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+#include "AsyncOutput.h"
+#include <cerrno>
+#include <climits>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/uio.h>
+
+using namespace std;
+
+namespace
+{
+    // number of buffers gathered into a single writev call
+    const size_t MaxGather = 64;
+}
+
+AsyncOutput::AsyncOutput()
+{
+    fd = -1;
+    failed = false;
+    closing = false;
+}
+
+AsyncOutput::~AsyncOutput()
+{
+    Close();
+}
+
+bool AsyncOutput::Open(const string &filename, bool append)
+{
+    if (fd >= 0)
+        return false;
+    fd = open(filename.c_str(), O_WRONLY | O_CREAT | (append ? O_APPEND : O_TRUNC), 0666);
+    if (fd < 0)
+        return false;
+    failed = false;
+    closing = false;
+    worker = thread(&AsyncOutput::flusher, this);
+    return true;
+}
+
+bool AsyncOutput::Close()
+{
+    if (fd < 0)
+        return false;
+    {
+        lock_guard<mutex> guard(lock);
+        closing = true;
+    }
+    work.notify_all();
+    worker.join();
+
+    bool result = !failed && close(fd) == 0;
+    if (failed)
+        close(fd);
+    fd = -1;
+    for (size_t i = 0; i < spare.size(); i++)
+        delete spare[i];
+    spare.clear();
+    return result;
+}
+
+bool AsyncOutput::Failed()
+{
+    lock_guard<mutex> guard(lock);
+    return failed;
+}
+
+bool AsyncOutput::Submit(vector<char> &buffer)
+{
+    if (fd < 0)
+        return false;
+    if (buffer.empty())
+        return !Failed();
+
+    unique_lock<mutex> guard(lock);
+    while (pending.size() >= MaxPending && !failed)
+        done.wait(guard);
+    if (failed)
+        return false;
+    vector<char> *full;
+    if (spare.empty())
+        full = new vector<char>();
+    else
+    {
+        full = spare.back();
+        spare.pop_back();
+    }
+    full->swap(buffer);
+    pending.push_back(full);
+    guard.unlock();
+    work.notify_one();
+    return true;
+}
+
+void AsyncOutput::flusher()
+{
+    vector<vector<char> *> batch;
+    while (true)
+    {
+        {
+            unique_lock<mutex> guard(lock);
+            while (pending.empty() && !closing)
+                work.wait(guard);
+            if (pending.empty())
+                return;
+            while (!pending.empty() && batch.size() < MaxGather)
+            {
+                batch.push_back(pending.front());
+                pending.pop_front();
+            }
+        }
+
+        bool written = writeAll(batch);
+        {
+            lock_guard<mutex> guard(lock);
+            if (!written)
+                failed = true;
+            for (size_t i = 0; i < batch.size(); i++)
+            {
+                batch[i]->clear();
+                spare.push_back(batch[i]);
+            }
+        }
+        batch.clear();
+        done.notify_all();
+    }
+}
+
+bool AsyncOutput::writeAll(const vector<vector<char> *> &buffers)
+{
+    if (Failed())
+        return false;
+    vector<struct iovec> iov(buffers.size());
+    for (size_t i = 0; i < buffers.size(); i++)
+    {
+        iov[i].iov_base = &(*buffers[i])[0];
+        iov[i].iov_len = buffers[i]->size();
+    }
+
+    // writev may write less than requested, continue where it stopped
+    size_t first = 0;
+    while (first < iov.size())
+    {
+        ssize_t n = writev(fd, &iov[first], min(iov.size() - first, (size_t)IOV_MAX));
+        if (n < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        while (first < iov.size() && (size_t)n >= iov[first].iov_len)
+        {
+            n -= iov[first].iov_len;
+            first++;
+        }
+        if (first < iov.size())
+        {
+            iov[first].iov_base = (char *)iov[first].iov_base + n;
+            iov[first].iov_len -= n;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,80 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+/*
+ * Asynchronous file output. Filled buffers are handed over to a background
+ * thread, which writes them to disk with writev, so that the producer does not
+ * wait for the disk unless it gets more than MaxPending buffers ahead.
+ */
+
+#ifndef _ASYNCOUTPUT_H
+#define _ASYNCOUTPUT_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+using namespace std;
+
+class AsyncOutput
+{
+public:
+    static const size_t DefaultBufferSize = 1 << 22;
+    static const size_t MaxPending = 16;
+
+public:
+    AsyncOutput();
+    virtual ~AsyncOutput();
+
+    bool Open(const string &filename, bool append = false);
+    // waits for all pending buffers to be written, false if any write failed
+    bool Close();
+    bool IsOpen() const { return fd >= 0; }
+    bool Failed();
+    // takes over the contents of buffer and replaces it with an empty buffer from the pool
+    bool Submit(vector<char> &buffer);
+
+private:
+    void flusher();
+    bool writeAll(const vector<vector<char> *> &buffers);
+
+private:
+    int fd;
+    bool failed;
+    bool closing;
+    deque<vector<char> *> pending;
+    vector<vector<char> *> spare;
+    thread worker;
+    mutex lock;
+    condition_variable work, done;
+};
+
+#endif
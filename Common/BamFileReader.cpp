@@ -0,0 +1,287 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+#include "BamFileReader.h"
+#include <cstring>
+#include <algorithm>
+
+using namespace std;
+
+namespace
+{
+    // fixed part of a record, following its block_size field
+    const size_t CoreSize = 32;
+
+    template <class T>
+    inline T readValue(const char *data)
+    {
+        T value;
+        memcpy(&value, data, sizeof(T));
+        return value;
+    }
+}
+
+BamFileReader::BamFileReader()
+    : bufferPos(0), bufferEnd(0), failed(false)
+{
+}
+
+BamFileReader::~BamFileReader()
+{
+    Close();
+}
+
+bool BamFileReader::Open(const string &fileName, int threads)
+{
+    if (input.IsOpen() || !input.Open(fileName, threads))
+        return false;
+    buffer.resize(BufferSize);
+    bufferPos = bufferEnd = 0;
+    failed = false;
+    if (!readHeader())
+    {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+bool BamFileReader::Close()
+{
+    references.clear();
+    headerText.clear();
+    return input.Close();
+}
+
+bool BamFileReader::IsOpen() const
+{
+    return input.IsOpen();
+}
+
+bool BamFileReader::Failed() const
+{
+    return failed || input.Failed();
+}
+
+bool BamFileReader::Rewind()
+{
+    if (!input.Rewind())
+        return false;
+    bufferPos = bufferEnd = 0;
+    failed = false;
+    references.clear();
+    headerText.clear();
+    return readHeader();
+}
+
+bool BamFileReader::GetNextAlignment(BamAlignment &alg)
+{
+    if (!readRecord())
+        return false;
+    decodeCore(alg);
+    decodeCharData(alg);
+    return true;
+}
+
+bool BamFileReader::GetNextAlignmentCore(BamAlignment &alg)
+{
+    if (!readRecord())
+        return false;
+    decodeCore(alg);
+    decodeNameAndTags(alg);
+    return true;
+}
+
+const RefVector &BamFileReader::GetReferenceData() const
+{
+    return references;
+}
+
+int BamFileReader::GetReferenceCount() const
+{
+    return references.size();
+}
+
+const string &BamFileReader::GetHeaderText() const
+{
+    return headerText;
+}
+
+bool BamFileReader::readHeader()
+{
+    char magic[4];
+    int32_t textLength, referenceCount;
+    if (!read(magic, sizeof(magic)) || memcmp(magic, "BAM\1", sizeof(magic)) != 0 || !read(&textLength, sizeof(textLength)) || textLength < 0)
+        return false;
+    headerText.resize(textLength);
+    if (textLength > 0 && !read(&headerText[0], textLength))
+        return false;
+    // the header text may be padded with NULs
+    headerText.resize(strlen(headerText.c_str()));
+
+    if (!read(&referenceCount, sizeof(referenceCount)) || referenceCount < 0)
+        return false;
+    references.resize(referenceCount);
+    for (int32_t i = 0; i < referenceCount; i++)
+    {
+        int32_t nameLength, length;
+        if (!read(&nameLength, sizeof(nameLength)) || nameLength <= 0)
+            return false;
+        record.resize(nameLength);
+        if (!read(&record[0], nameLength) || !read(&length, sizeof(length)))
+            return false;
+        references[i].RefName.assign(&record[0], strnlen(&record[0], nameLength));
+        references[i].RefLength = length;
+    }
+    return true;
+}
+
+// Loads the next record into the record buffer, false at the end of input or on error.
+bool BamFileReader::readRecord()
+{
+    int32_t blockSize;
+    if (!read(&blockSize, sizeof(blockSize)))
+        return false;
+    if (blockSize < (int32_t)CoreSize)
+    {
+        failed = true;
+        return false;
+    }
+    record.resize(blockSize);
+    if (!read(&record[0], blockSize))
+    {
+        failed = true;
+        return false;
+    }
+
+    // check that the variable length parts fit the block
+    const char *data = &record[0];
+    size_t nameLength = (unsigned char)data[8];
+    size_t cigarLength = readValue<uint16_t>(data + 12);
+    int32_t sequenceLength = readValue<int32_t>(data + 16);
+    if (sequenceLength < 0 || CoreSize + nameLength + 4 * cigarLength + (sequenceLength + 1) / 2 + sequenceLength > (size_t)blockSize)
+    {
+        failed = true;
+        return false;
+    }
+    return true;
+}
+
+// Copies exactly size bytes of inflated data, refilling the buffer as needed.
+bool BamFileReader::read(void *data, size_t size)
+{
+    char *out = (char *)data;
+    while (size > 0)
+    {
+        if (bufferPos == bufferEnd)
+        {
+            bufferPos = 0;
+            bufferEnd = input.Read(&buffer[0], buffer.size());
+            if (bufferEnd == 0)
+                return false;
+        }
+        size_t n = min(size, bufferEnd - bufferPos);
+        memcpy(out, &buffer[bufferPos], n);
+        bufferPos += n;
+        out += n;
+        size -= n;
+    }
+    return true;
+}
+
+void BamFileReader::decodeCore(BamAlignment &alg) const
+{
+    static const char cigarTypes[] = "MIDNSHP=X";
+    const char *data = &record[0];
+    alg.RefID = readValue<int32_t>(data);
+    alg.Position = readValue<int32_t>(data + 4);
+    alg.MapQuality = (unsigned char)data[9];
+    alg.Bin = readValue<uint16_t>(data + 10);
+    alg.AlignmentFlag = readValue<uint16_t>(data + 14);
+    alg.Length = readValue<int32_t>(data + 16);
+    alg.MateRefID = readValue<int32_t>(data + 20);
+    alg.MatePosition = readValue<int32_t>(data + 24);
+    alg.InsertSize = readValue<int32_t>(data + 28);
+
+    size_t nameLength = (unsigned char)data[8];
+    size_t cigarLength = readValue<uint16_t>(data + 12);
+    const char *cigar = data + CoreSize + nameLength;
+    alg.CigarData.resize(cigarLength);
+    for (size_t i = 0; i < cigarLength; i++)
+    {
+        uint32_t op = readValue<uint32_t>(cigar + 4 * i);
+        alg.CigarData[i].Type = (op & 0xf) < 9 ? cigarTypes[op & 0xf] : '?';
+        alg.CigarData[i].Length = op >> 4;
+    }
+}
+
+void BamFileReader::decodeCharData(BamAlignment &alg) const
+{
+    static const char bases[] = "=ACMGRSVTWYHKDBN";
+    const char *data = &record[0], *end = data + record.size();
+    size_t nameLength = (unsigned char)data[8];
+    size_t cigarLength = readValue<uint16_t>(data + 12);
+    size_t sequenceLength = readValue<int32_t>(data + 16);
+
+    const char *name = data + CoreSize;
+    alg.Name.assign(name, nameLength > 0 ? strnlen(name, nameLength) : 0);
+
+    const unsigned char *sequence = (const unsigned char *)(name + nameLength + 4 * cigarLength);
+    alg.QueryBases.resize(sequenceLength);
+    for (size_t i = 0; i < sequenceLength; i++)
+        alg.QueryBases[i] = bases[(sequence[i / 2] >> (i & 1 ? 0 : 4)) & 0xf];
+
+    const char *quality = (const char *)sequence + (sequenceLength + 1) / 2;
+    alg.Qualities.resize(sequenceLength);
+    if (sequenceLength > 0 && quality[0] == (char)0xff)
+        memset(&alg.Qualities[0], 0xff, sequenceLength);
+    else
+        for (size_t i = 0; i < sequenceLength; i++)
+            alg.Qualities[i] = quality[i] + 33;
+
+    const char *tags = quality + sequenceLength;
+    alg.TagData.assign(tags, end - tags);
+    alg.AlignedBases.clear();
+}
+
+// Like decodeCharData without unpacking the bases and qualities.
+void BamFileReader::decodeNameAndTags(BamAlignment &alg) const
+{
+    const char *data = &record[0], *end = data + record.size();
+    size_t nameLength = (unsigned char)data[8];
+    size_t cigarLength = readValue<uint16_t>(data + 12);
+    size_t sequenceLength = readValue<int32_t>(data + 16);
+
+    const char *name = data + CoreSize;
+    alg.Name.assign(name, nameLength > 0 ? strnlen(name, nameLength) : 0);
+
+    const char *tags = name + nameLength + 4 * cigarLength + (sequenceLength + 1) / 2 + sequenceLength;
+    alg.TagData.assign(tags, end - tags);
+    alg.QueryBases.clear();
+    alg.Qualities.clear();
+    alg.AlignedBases.clear();
+}
@@ -0,0 +1,89 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+/*
+ * BAM input decoded without BamTools' reader. BGZF blocks are inflated ahead of
+ * the consumer by the CompressedInput worker threads and records are decoded
+ * from the inflated stream into BamAlignment objects, filling the same fields
+ * BamReader::GetNextAlignment does (AlignedBases excepted, nothing here uses it).
+ * TagData keeps the raw BAM encoding, so GetTag and AlignmentTags work as usual.
+ */
+
+#ifndef _BAMFILEREADER_H
+#define _BAMFILEREADER_H
+
+#include "api/BamAlignment.h"
+#include "CompressedInput.h"
+#include <cstddef>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace BamTools;
+
+class BamFileReader
+{
+public:
+    BamFileReader();
+    ~BamFileReader();
+
+public:
+    // threads <= 0 uses all available cores
+    bool Open(const string &fileName, int threads = 0);
+    bool Close();
+    bool IsOpen() const;
+    bool Failed() const;
+    bool Rewind();
+    bool GetNextAlignment(BamAlignment &alg);
+    // core fields, name and raw tags only, QueryBases and Qualities are left empty
+    bool GetNextAlignmentCore(BamAlignment &alg);
+    const RefVector &GetReferenceData() const;
+    int GetReferenceCount() const;
+    const string &GetHeaderText() const;
+
+private:
+    bool readHeader();
+    bool readRecord();
+    bool read(void *data, size_t size);
+    void decodeCore(BamAlignment &alg) const;
+    void decodeCharData(BamAlignment &alg) const;
+    void decodeNameAndTags(BamAlignment &alg) const;
+
+private:
+    static const size_t BufferSize = 1 << 20;
+
+    CompressedInput input;
+    vector<char> buffer;
+    size_t bufferPos, bufferEnd;
+    vector<char> record;
+    RefVector references;
+    string headerText;
+    bool failed;
+};
+
+#endif
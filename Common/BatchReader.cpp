@@ -0,0 +1,402 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+#include "BatchReader.h"
+#include "SequenceKernels.h"
+#include "TaskScheduler.h"
+#include <cstring>
+#include <cctype>
+#include <algorithm>
+
+using namespace std;
+
+namespace
+{
+    const int SlotsPerThread = 2;
+
+    // appends a line without its trailing whitespace, capacity is reserved by the caller
+    void appendLine(vector<char> &arena, const char *line, const char *end, bool upper)
+    {
+        while (end > line && isspace(end[-1]))
+            --end;
+        size_t offset = arena.size();
+        arena.insert(arena.end(), line, end);
+        if (upper)
+            SequenceKernels::ToUpper(arena.data() + offset, arena.size() - offset);
+    }
+}
+
+RecordBatch::RecordBatch()
+{
+    index = -1;
+    first = 0;
+    failed = false;
+}
+
+void RecordBatch::Get(size_t i, FastASequence &seq) const
+{
+    seq.Comment.assign(records[i].Comment, records[i].CommentLength);
+    seq.Nucleotides.assign(records[i].Sequence, records[i].Length);
+}
+
+void RecordBatch::Get(size_t i, FastQSequence &seq) const
+{
+    seq.Comment.assign(records[i].Comment, records[i].CommentLength);
+    seq.Nucleotides.assign(records[i].Sequence, records[i].Length);
+    seq.Quality.assign(records[i].Quality, records[i].QualityLength);
+}
+
+void RecordBatch::Clear()
+{
+    index = -1;
+    first = 0;
+    failed = false;
+    arena.clear();
+    records.clear();
+}
+
+void RecordBatch::Swap(RecordBatch &other)
+{
+    swap(index, other.index);
+    swap(first, other.first);
+    swap(failed, other.failed);
+    arena.swap(other.arena);
+    records.swap(other.records);
+}
+
+BatchReader::BatchReader()
+{
+    data = NULL;
+    size = 0;
+    fastq = false;
+    failed = false;
+    batchSize = DefaultBatchSize;
+    rangeCount = recordCount = 0;
+    claimed = consumed = 0;
+    stopping = false;
+}
+
+BatchReader::~BatchReader()
+{
+    Close();
+}
+
+bool BatchReader::Open(const string &filename, bool fastq, int threads, size_t batchSize)
+{
+    if (!file.Open(filename))
+        return false;
+    data = file.Data();
+    size = file.Size();
+    this->fastq = fastq;
+    this->batchSize = max(batchSize, (size_t)1);
+    rangeCount = (size + this->batchSize - 1) / this->batchSize;
+    recordCount = 0;
+    failed = false;
+
+    if (threads <= 0)
+        threads = TaskScheduler::GetThreadCount();
+    if (threads < 1)
+        threads = 1;
+    slots.resize(SlotsPerThread * threads);
+    for (size_t i = 0; i < slots.size(); i++)
+        slots[i].Ready = false;
+    claimed = consumed = 0;
+    stopping = false;
+    // a single thread parses the ranges itself when they are requested
+    if (threads > 1)
+        for (int i = 0; i < threads; i++)
+            workers.push_back(thread(&BatchReader::worker, this));
+    return true;
+}
+
+bool BatchReader::Close()
+{
+    if (!file.IsOpen())
+        return false;
+    stopWorkers();
+    slots.clear();
+    data = NULL;
+    size = 0;
+    return file.Close();
+}
+
+bool BatchReader::Read(RecordBatch &batch)
+{
+    while (!failed && consumed < rangeCount)
+    {
+        Slot &slot = slots[consumed % slots.size()];
+        if (workers.empty())
+            parseRange(consumed, slot.Batch);
+        else
+        {
+            unique_lock<mutex> guard(lock);
+            while (!slot.Ready)
+                batchReady.wait(guard);
+            slot.Ready = false;
+        }
+
+        // the caller's previous batch is recycled for a later range
+        batch.Swap(slot.Batch);
+        {
+            lock_guard<mutex> guard(lock);
+            consumed++;
+        }
+        workAvailable.notify_all();
+
+        if (batch.failed)
+            failed = true;
+        else
+        {
+            batch.first = recordCount;
+            recordCount += batch.Size();
+            // a range without records lies entirely inside a record longer than the batch size
+            if (batch.Size() > 0)
+                return true;
+        }
+    }
+    return false;
+}
+
+long long BatchReader::Read(vector<FastASequence> &sequences)
+{
+    RecordBatch batch;
+    sequences.clear();
+    while (Read(batch))
+    {
+        size_t offset = sequences.size();
+        sequences.resize(offset + batch.Size());
+        for (size_t i = 0; i < batch.Size(); i++)
+            batch.Get(i, sequences[offset + i]);
+    }
+    return failed ? -1 : sequences.size();
+}
+
+long long BatchReader::Read(vector<FastQSequence> &sequences)
+{
+    RecordBatch batch;
+    sequences.clear();
+    while (Read(batch))
+    {
+        size_t offset = sequences.size();
+        sequences.resize(offset + batch.Size());
+        for (size_t i = 0; i < batch.Size(); i++)
+            batch.Get(i, sequences[offset + i]);
+    }
+    return failed ? -1 : sequences.size();
+}
+
+size_t BatchReader::lineEnd(size_t pos) const
+{
+    const char *eol = (const char *)memchr(data + pos, '\n', size - pos);
+    return eol == NULL ? size : eol - data;
+}
+
+// '@' header, sequence line, '+' line and a quality line of the same length
+bool BatchReader::isFastQRecord(size_t pos) const
+{
+    if (data[pos] != '@')
+        return false;
+    size_t sequence = lineEnd(pos) + 1;
+    if (sequence >= size)
+        return false;
+    size_t sequenceEnd = lineEnd(sequence);
+    size_t separator = sequenceEnd + 1;
+    if (separator >= size || data[separator] != '+')
+        return false;
+    size_t quality = min(lineEnd(separator) + 1, size);
+    size_t qualityEnd = lineEnd(quality);
+    while (sequenceEnd > sequence && isspace(data[sequenceEnd - 1]))
+        --sequenceEnd;
+    while (qualityEnd > quality && isspace(data[qualityEnd - 1]))
+        --qualityEnd;
+    return sequenceEnd - sequence == qualityEnd - quality;
+}
+
+// finds the first record starting at or after pos
+size_t BatchReader::alignToRecord(size_t pos) const
+{
+    if (pos == 0 || pos >= size)
+        return min(pos, size);
+    size_t line = data[pos - 1] == '\n' ? pos : lineEnd(pos) + 1;
+    while (line < size)
+    {
+        if (fastq ? isFastQRecord(line) : data[line] == '>')
+            return line;
+        line = lineEnd(line) + 1;
+    }
+    return size;
+}
+
+void BatchReader::parseRange(long long index, RecordBatch &batch) const
+{
+    size_t begin = alignToRecord((size_t)index * batchSize);
+    size_t end = alignToRecord(min((size_t)(index + 1) * batchSize, size));
+    batch.Clear();
+    batch.index = index;
+    batch.failed = !parse(begin, end, batch);
+}
+
+bool BatchReader::parse(size_t begin, size_t end, RecordBatch &batch) const
+{
+    // parsed data is never longer than its input, so the arena is not reallocated while the records point into it
+    if (batch.arena.capacity() < end - begin)
+    {
+        vector<char> arena;
+        arena.reserve(end - begin);
+        batch.arena.swap(arena);
+    }
+    return fastq ? parseFastQ(begin, end, batch) : parseFastA(begin, end, batch);
+}
+
+bool BatchReader::parseFastA(size_t begin, size_t end, RecordBatch &batch) const
+{
+    vector<char> &arena = batch.arena;
+    size_t pos = begin;
+    while (pos < end)
+    {
+        size_t eol = lineEnd(pos);
+        const char *line = data + pos;
+        while (line < data + eol && isspace(*line))
+            ++line;
+        if (line == data + eol)
+        {
+            pos = eol + 1;
+            continue;
+        }
+        if (data[pos] != '>')
+            return false;
+
+        BatchRecord record;
+        size_t commentEnd = eol > pos + 1 && data[eol - 1] == '\r' ? eol - 1 : eol;
+        record.Comment = arena.data() + arena.size();
+        record.CommentLength = commentEnd - pos - 1;
+        arena.insert(arena.end(), data + pos + 1, data + commentEnd);
+
+        record.Sequence = arena.data() + arena.size();
+        size_t offset = arena.size();
+        for (pos = eol + 1; pos < end && data[pos] != '>'; pos = eol + 1)
+        {
+            eol = lineEnd(pos);
+            appendLine(arena, data + pos, data + eol, true);
+        }
+        record.Length = arena.size() - offset;
+        record.Quality = NULL;
+        record.QualityLength = 0;
+        batch.records.push_back(record);
+    }
+    return true;
+}
+
+bool BatchReader::parseFastQ(size_t begin, size_t end, RecordBatch &batch) const
+{
+    vector<char> &arena = batch.arena;
+    size_t pos = begin;
+    while (pos < end)
+    {
+        size_t eol = lineEnd(pos);
+        const char *line = data + pos;
+        while (line < data + eol && isspace(*line))
+            ++line;
+        if (line == data + eol)
+        {
+            pos = eol + 1;
+            continue;
+        }
+        if (data[pos] != '@')
+            return false;
+
+        BatchRecord record;
+        size_t commentEnd = eol > pos + 1 && data[eol - 1] == '\r' ? eol - 1 : eol;
+        record.Comment = arena.data() + arena.size();
+        record.CommentLength = commentEnd - pos - 1;
+        arena.insert(arena.end(), data + pos + 1, data + commentEnd);
+
+        record.Sequence = arena.data() + arena.size();
+        size_t offset = arena.size();
+        for (pos = eol + 1; pos < end && data[pos] != '+'; pos = eol + 1)
+        {
+            eol = lineEnd(pos);
+            appendLine(arena, data + pos, data + eol, true);
+        }
+        record.Length = arena.size() - offset;
+
+        // quality scores may be wrapped just like the sequence
+        record.Quality = arena.data() + arena.size();
+        offset = arena.size();
+        if (pos < end)
+        {
+            pos = lineEnd(pos) + 1;
+            do
+            {
+                if (pos >= end)
+                    break;
+                eol = lineEnd(pos);
+                appendLine(arena, data + pos, data + eol, false);
+                pos = eol + 1;
+            } while (arena.size() - offset < record.Length);
+        }
+        record.QualityLength = arena.size() - offset;
+        batch.records.push_back(record);
+    }
+    return true;
+}
+
+void BatchReader::stopWorkers()
+{
+    {
+        lock_guard<mutex> guard(lock);
+        stopping = true;
+    }
+    workAvailable.notify_all();
+    for (size_t i = 0; i < workers.size(); i++)
+        workers[i].join();
+    workers.clear();
+}
+
+void BatchReader::worker()
+{
+    while (true)
+    {
+        long long index;
+        {
+            unique_lock<mutex> guard(lock);
+            while (!stopping && (claimed >= rangeCount || claimed - consumed >= (long long)slots.size()))
+                workAvailable.wait(guard);
+            if (stopping)
+                return;
+            index = claimed++;
+        }
+
+        Slot &slot = slots[index % slots.size()];
+        parseRange(index, slot.Batch);
+        {
+            lock_guard<mutex> guard(lock);
+            slot.Ready = true;
+        }
+        batchReady.notify_all();
+    }
+}
@@ -0,0 +1,146 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+/*
+ * Parallel FastA/FastQ parser. The (mapped) input is cut into byte ranges that
+ * are aligned to record boundaries; every range is parsed by one of the worker
+ * threads into a RecordBatch, and batches are handed to the caller in input order.
+ *
+ * FastQ ranges are aligned on the assumption that a record header is followed by
+ * a single sequence line and a '+' line, i.e. the common unwrapped FastQ layout.
+ */
+
+#ifndef _BATCHREADER_H
+#define _BATCHREADER_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include "MappedReader.h"
+#include "Sequence.h"
+
+using namespace std;
+
+// Single parsed record, all pointers refer to the arena of the owning batch.
+struct BatchRecord
+{
+    const char *Comment;
+    size_t CommentLength;
+    const char *Sequence;
+    size_t Length;
+    // FastQ only, QualityLength is zero for FastA records
+    const char *Quality;
+    size_t QualityLength;
+};
+
+class RecordBatch
+{
+public:
+    RecordBatch();
+    virtual ~RecordBatch() {}
+
+    // position of the batch in the input
+    long long Index() const { return index; }
+    // input position of the first record in the batch
+    long long First() const { return first; }
+    size_t Size() const { return records.size(); }
+    const BatchRecord &operator[](size_t i) const { return records[i]; }
+    void Get(size_t i, FastASequence &seq) const;
+    void Get(size_t i, FastQSequence &seq) const;
+    void Clear();
+    void Swap(RecordBatch &other);
+
+private:
+    friend class BatchReader;
+    long long index;
+    long long first;
+    bool failed;
+    // parsed comments, sequences and qualities are stored back to back in here
+    vector<char> arena;
+    vector<BatchRecord> records;
+};
+
+class BatchReader
+{
+public:
+    static const size_t DefaultBatchSize = 1 << 22;
+
+public:
+    BatchReader();
+    virtual ~BatchReader();
+
+    // threads <= 0 uses the process thread budget
+    bool Open(const string &filename, bool fastq, int threads = 0, size_t batchSize = DefaultBatchSize);
+    bool Close();
+    bool IsOpen() const { return file.IsOpen(); }
+    bool Failed() const { return failed; }
+    // stores the next batch in input order into batch, returns false at the end of input or on error
+    bool Read(RecordBatch &batch);
+    // reads all remaining records
+    long long Read(vector<FastASequence> &sequences);
+    long long Read(vector<FastQSequence> &sequences);
+
+private:
+    struct Slot
+    {
+        RecordBatch Batch;
+        bool Ready;
+    };
+
+    size_t alignToRecord(size_t pos) const;
+    bool isFastQRecord(size_t pos) const;
+    size_t lineEnd(size_t pos) const;
+    bool parse(size_t begin, size_t end, RecordBatch &batch) const;
+    bool parseFastA(size_t begin, size_t end, RecordBatch &batch) const;
+    bool parseFastQ(size_t begin, size_t end, RecordBatch &batch) const;
+    void parseRange(long long index, RecordBatch &batch) const;
+    void stopWorkers();
+    void worker();
+
+private:
+    MappedFile file;
+    const char *data;
+    size_t size;
+    bool fastq;
+    bool failed;
+    size_t batchSize;
+    long long rangeCount;
+    long long recordCount;
+
+    // ranges are claimed by the workers in order, at most slots.size() are in flight
+    vector<Slot> slots;
+    long long claimed, consumed;
+    vector<thread> workers;
+    mutex lock;
+    condition_variable workAvailable, batchReady;
+    bool stopping;
+};
+
+#endif
@@ -0,0 +1,480 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+#include "CompressedInput.h"
+#include "TaskScheduler.h"
+#include <cstring>
+#include <algorithm>
+
+using namespace std;
+
+namespace
+{
+    const size_t GzipBufferSize = 1 << 18;
+    const size_t BGZFHeaderSize = 18;
+    const size_t BGZFFooterSize = 8;
+    const int BlocksPerThread = 8;
+    // amount of decompressed data kept around to serve backward seeks on a stream
+    const size_t HistorySize = 1 << 20;
+
+    struct CompressedStream
+    {
+        CompressedInput Input;
+        vector<char> Window;
+        long long WindowStart;
+        long long Position;
+    };
+
+    ssize_t streamRead(void *cookie, char *buf, size_t size)
+    {
+        CompressedStream *stream = (CompressedStream *)cookie;
+        long long windowEnd = stream->WindowStart + stream->Window.size();
+        if (stream->Position < windowEnd)
+        {
+            size_t n = min((long long)size, windowEnd - stream->Position);
+            memcpy(buf, &stream->Window[stream->Position - stream->WindowStart], n);
+            stream->Position += n;
+            return n;
+        }
+
+        size_t n = stream->Input.Read(buf, size);
+        if (n == 0)
+            return stream->Input.Failed() ? -1 : 0;
+        stream->Window.insert(stream->Window.end(), buf, buf + n);
+        if (stream->Window.size() > 2 * HistorySize)
+        {
+            size_t drop = stream->Window.size() - HistorySize;
+            stream->Window.erase(stream->Window.begin(), stream->Window.begin() + drop);
+            stream->WindowStart += drop;
+        }
+        stream->Position += n;
+        return n;
+    }
+
+    int streamSeek(void *cookie, off64_t *offset, int whence)
+    {
+        CompressedStream *stream = (CompressedStream *)cookie;
+        long long target;
+        if (whence == SEEK_SET)
+            target = *offset;
+        else if (whence == SEEK_CUR)
+            target = stream->Position + *offset;
+        else
+            return -1;
+        if (target < 0)
+            return -1;
+
+        if (target < stream->WindowStart)
+        {
+            // too far back, decompress again from the start
+            if (!stream->Input.Rewind())
+                return -1;
+            stream->Window.clear();
+            stream->WindowStart = 0;
+            stream->Position = 0;
+        }
+        char buf[1 << 16];
+        stream->Position = min(stream->Position, target);
+        while (stream->Position < target)
+        {
+            ssize_t n = streamRead(cookie, buf, min((long long)sizeof(buf), target - stream->Position));
+            if (n <= 0)
+                return -1;
+        }
+        *offset = stream->Position;
+        return 0;
+    }
+
+    int streamClose(void *cookie)
+    {
+        CompressedStream *stream = (CompressedStream *)cookie;
+        bool closed = stream->Input.Close();
+        delete stream;
+        return closed ? 0 : EOF;
+    }
+}
+
+CompressedInput::CompressedInput()
+{
+    fin = NULL;
+    bgzf = failed = eof = false;
+    streamOpen = memberEnd = false;
+    head = tail = claimed = 0;
+    offset = 0;
+    threadCount = 0;
+    stopping = false;
+    memset(&stream, 0, sizeof(stream));
+}
+
+CompressedInput::~CompressedInput()
+{
+    Close();
+}
+
+bool CompressedInput::IsCompressed(const string &filename)
+{
+    FILE *f = fopen(filename.c_str(), "rb");
+    if (f == NULL)
+        return false;
+    unsigned char magic[2];
+    bool result = fread(magic, 1, 2, f) == 2 && magic[0] == 0x1f && magic[1] == 0x8b;
+    fclose(f);
+    return result;
+}
+
+FILE *CompressedInput::OpenStream(const string &filename, int threads)
+{
+    CompressedStream *stream = new CompressedStream();
+    if (!stream->Input.Open(filename, threads))
+    {
+        delete stream;
+        return NULL;
+    }
+    stream->WindowStart = 0;
+    stream->Position = 0;
+
+    cookie_io_functions_t functions;
+    functions.read = streamRead;
+    functions.write = NULL;
+    functions.seek = streamSeek;
+    functions.close = streamClose;
+    FILE *f = fopencookie(stream, "r", functions);
+    if (f == NULL)
+        delete stream;
+    return f;
+}
+
+bool CompressedInput::Open(const string &filename, int threads)
+{
+    if (fin != NULL)
+        return false;
+    fin = fopen(filename.c_str(), "rb");
+    if (fin == NULL)
+        return false;
+    failed = eof = false;
+    if (!detectFormat())
+    {
+        Close();
+        return false;
+    }
+
+    if (bgzf)
+    {
+        threadCount = threads > 0 ? threads : TaskScheduler::GetThreadCount();
+        if (threadCount < 1)
+            threadCount = 1;
+        slots.resize(max(2 * BlocksPerThread, threadCount * BlocksPerThread));
+        head = tail = claimed = 0;
+        offset = 0;
+        startWorkers();
+        fill();
+    }
+    else
+    {
+        memset(&stream, 0, sizeof(stream));
+        // 15 + 32: maximal window size, gzip header detected automatically
+        if (inflateInit2(&stream, 15 + 32) != Z_OK)
+        {
+            Close();
+            return false;
+        }
+        streamOpen = true;
+        memberEnd = false;
+        input.resize(GzipBufferSize);
+    }
+    return true;
+}
+
+bool CompressedInput::Close()
+{
+    if (fin == NULL)
+        return false;
+    stopWorkers();
+    slots.clear();
+    if (streamOpen)
+        inflateEnd(&stream);
+    streamOpen = false;
+    fclose(fin);
+    fin = NULL;
+    return true;
+}
+
+bool CompressedInput::Rewind()
+{
+    if (fin == NULL)
+        return false;
+    if (bgzf)
+        stopWorkers();
+    if (fseek(fin, 0, SEEK_SET) != 0)
+        return false;
+    failed = eof = false;
+    if (bgzf)
+    {
+        for (size_t i = 0; i < slots.size(); i++)
+            slots[i].Ready = false;
+        head = tail = claimed = 0;
+        offset = 0;
+        startWorkers();
+        fill();
+    }
+    else
+    {
+        inflateReset(&stream);
+        stream.avail_in = 0;
+        memberEnd = false;
+    }
+    return true;
+}
+
+size_t CompressedInput::Read(char *buf, size_t size)
+{
+    if (fin == NULL || size == 0)
+        return 0;
+    return bgzf ? readBGZF(buf, size) : readGzip(buf, size);
+}
+
+bool CompressedInput::detectFormat()
+{
+    unsigned char header[BGZFHeaderSize];
+    size_t n = fread(header, 1, BGZFHeaderSize, fin);
+    if (n < 2 || header[0] != 0x1f || header[1] != 0x8b)
+        return false;
+    // BGZF: gzip member with FEXTRA set and a 'BC' subfield holding the block size
+    bgzf = n == BGZFHeaderSize && header[2] == 8 && (header[3] & 4) != 0 && header[12] == 'B' && header[13] == 'C';
+    return fseek(fin, 0, SEEK_SET) == 0;
+}
+
+size_t CompressedInput::readGzip(char *buf, size_t size)
+{
+    stream.next_out = (Bytef *)buf;
+    stream.avail_out = size;
+    while (stream.avail_out > 0 && !eof)
+    {
+        if (stream.avail_in == 0)
+        {
+            size_t n = fread(&input[0], 1, input.size(), fin);
+            if (n == 0)
+            {
+                // input ended in the middle of a member
+                if (!memberEnd)
+                    failed = true;
+                eof = true;
+                break;
+            }
+            stream.next_in = &input[0];
+            stream.avail_in = n;
+        }
+
+        int ret = inflate(&stream, Z_NO_FLUSH);
+        if (ret == Z_STREAM_END)
+        {
+            // another member may follow (concatenated gzip files)
+            memberEnd = true;
+            inflateReset(&stream);
+        }
+        else if (ret == Z_OK)
+            memberEnd = false;
+        else if (ret != Z_BUF_ERROR)
+        {
+            // garbage after the last member is ignored, just like gzip does
+            if (!memberEnd)
+                failed = true;
+            eof = true;
+        }
+    }
+    return size - stream.avail_out;
+}
+
+size_t CompressedInput::readBGZF(char *buf, size_t size)
+{
+    size_t done = 0;
+    while (done < size)
+    {
+        if (head == tail)
+        {
+            fill();
+            if (head == tail)
+                break;
+        }
+
+        Block &block = slots[head % slots.size()];
+        if (workers.empty())
+        {
+            if (!block.Ready)
+            {
+                inflateBlock(block);
+                block.Ready = true;
+            }
+        }
+        else
+        {
+            unique_lock<mutex> guard(lock);
+            while (!block.Ready)
+                blockReady.wait(guard);
+        }
+        if (block.Failed)
+        {
+            failed = true;
+            break;
+        }
+
+        size_t n = min(size - done, block.Data.size() - offset);
+        if (n > 0)
+            memcpy(buf + done, &block.Data[offset], n);
+        done += n;
+        offset += n;
+        if (offset == block.Data.size())
+        {
+            head++;
+            offset = 0;
+            fill();
+        }
+    }
+    return done;
+}
+
+bool CompressedInput::readBlock(Block &block)
+{
+    block.Compressed.resize(BGZFHeaderSize);
+    size_t n = fread(&block.Compressed[0], 1, BGZFHeaderSize, fin);
+    if (n == 0)
+        return false;
+    unsigned char *header = &block.Compressed[0];
+    if (n < BGZFHeaderSize || header[0] != 0x1f || header[1] != 0x8b || header[12] != 'B' || header[13] != 'C')
+    {
+        failed = true;
+        return false;
+    }
+    size_t blockSize = (header[16] | (header[17] << 8)) + 1;
+    if (blockSize < BGZFHeaderSize + BGZFFooterSize)
+    {
+        failed = true;
+        return false;
+    }
+    block.Compressed.resize(blockSize);
+    if (fread(&block.Compressed[BGZFHeaderSize], 1, blockSize - BGZFHeaderSize, fin) != blockSize - BGZFHeaderSize)
+    {
+        failed = true;
+        return false;
+    }
+    return true;
+}
+
+bool CompressedInput::inflateBlock(Block &block)
+{
+    const unsigned char *footer = &block.Compressed[block.Compressed.size() - BGZFFooterSize];
+    uLong crc = footer[0] | (footer[1] << 8) | (footer[2] << 16) | ((uLong)footer[3] << 24);
+    size_t length = footer[4] | (footer[5] << 8) | (footer[6] << 16) | ((size_t)footer[7] << 24);
+    block.Data.resize(length);
+    block.Failed = false;
+    if (length == 0)
+        return true;
+
+    z_stream s;
+    memset(&s, 0, sizeof(s));
+    // raw deflate data, the gzip wrapper is handled here
+    if (inflateInit2(&s, -15) != Z_OK)
+    {
+        block.Failed = true;
+        return false;
+    }
+    s.next_in = &block.Compressed[BGZFHeaderSize];
+    s.avail_in = block.Compressed.size() - BGZFHeaderSize - BGZFFooterSize;
+    s.next_out = (Bytef *)&block.Data[0];
+    s.avail_out = length;
+    int ret = inflate(&s, Z_FINISH);
+    block.Failed = ret != Z_STREAM_END || s.total_out != length || crc32(0, (const Bytef *)&block.Data[0], length) != crc;
+    inflateEnd(&s);
+    return !block.Failed;
+}
+
+// reads compressed blocks into the free slots of the ring and hands them out to the workers
+void CompressedInput::fill()
+{
+    while (!eof && tail - head < (long long)slots.size())
+    {
+        Block &block = slots[tail % slots.size()];
+        block.Ready = false;
+        block.Failed = false;
+        if (!readBlock(block))
+        {
+            eof = true;
+            break;
+        }
+        {
+            lock_guard<mutex> guard(lock);
+            tail++;
+        }
+        workAvailable.notify_one();
+    }
+}
+
+void CompressedInput::startWorkers()
+{
+    stopping = false;
+    // a single thread inflates the blocks itself when they are consumed
+    if (threadCount <= 1)
+        return;
+    for (int i = 0; i < threadCount; i++)
+        workers.push_back(thread(&CompressedInput::worker, this));
+}
+
+void CompressedInput::stopWorkers()
+{
+    {
+        lock_guard<mutex> guard(lock);
+        stopping = true;
+    }
+    workAvailable.notify_all();
+    for (size_t i = 0; i < workers.size(); i++)
+        workers[i].join();
+    workers.clear();
+}
+
+void CompressedInput::worker()
+{
+    while (true)
+    {
+        long long index;
+        {
+            unique_lock<mutex> guard(lock);
+            while (!stopping && claimed >= tail)
+                workAvailable.wait(guard);
+            if (stopping)
+                return;
+            index = claimed++;
+        }
+
+        Block &block = slots[index % slots.size()];
+        inflateBlock(block);
+        {
+            lock_guard<mutex> guard(lock);
+            block.Ready = true;
+        }
+        blockReady.notify_all();
+    }
+}
@@ -0,0 +1,112 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+/*
+ * Streaming decompression of gzip and BGZF input. Plain gzip (including
+ * multi-member files) is inflated on the calling thread. BGZF files consist of
+ * independent blocks, which are inflated ahead of the consumer by a pool of
+ * worker threads and handed out in file order.
+ */
+
+#ifndef _COMPRESSEDINPUT_H
+#define _COMPRESSEDINPUT_H
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <zlib.h>
+
+using namespace std;
+
+class CompressedInput
+{
+public:
+    CompressedInput();
+    virtual ~CompressedInput();
+
+    // threads <= 0 uses the process thread budget (BGZF only)
+    bool Open(const string &filename, int threads = 0);
+    bool Close();
+    bool IsOpen() const { return fin != NULL; }
+    bool IsBGZF() const { return bgzf; }
+    bool Failed() const { return failed; }
+    bool Rewind();
+    // returns the number of decompressed bytes written to buf, 0 at the end of input
+    size_t Read(char *buf, size_t size);
+
+    // checks the gzip magic number of a file
+    static bool IsCompressed(const string &filename);
+    // opens a compressed file as a read-only stdio stream, seeking backwards is supported
+    static FILE *OpenStream(const string &filename, int threads = 0);
+
+private:
+    struct Block
+    {
+        vector<unsigned char> Compressed;
+        vector<char> Data;
+        bool Ready;
+        bool Failed;
+    };
+
+    bool detectFormat();
+    size_t readGzip(char *buf, size_t size);
+    size_t readBGZF(char *buf, size_t size);
+    bool readBlock(Block &block);
+    static bool inflateBlock(Block &block);
+    void fill();
+    void startWorkers();
+    void stopWorkers();
+    void worker();
+
+private:
+    FILE *fin;
+    bool bgzf;
+    bool failed;
+    bool eof;
+
+    // plain gzip state
+    z_stream stream;
+    bool streamOpen;
+    bool memberEnd;
+    vector<unsigned char> input;
+
+    // BGZF state: ring of blocks, indices grow monotonically
+    vector<Block> slots;
+    long long head, tail, claimed;
+    size_t offset;
+    vector<thread> workers;
+    int threadCount;
+    mutex lock;
+    condition_variable workAvailable, blockReady;
+    bool stopping;
+};
+
+#endif
@@ -0,0 +1,299 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+#include "CompressedOutput.h"
+#include "TaskScheduler.h"
+#include <cstring>
+#include <algorithm>
+
+using namespace std;
+
+namespace
+{
+    const size_t BGZFHeaderSize = 18;
+    const size_t BGZFFooterSize = 8;
+    const size_t BGZFMaxBlockSize = 1 << 16;
+    const int BlocksPerThread = 4;
+
+    // empty block which marks the end of a BGZF file
+    const unsigned char EOFBlock[28] = { 0x1f, 0x8b, 8, 4, 0, 0, 0, 0, 0, 0xff, 6, 0, 'B', 'C', 2, 0, 0x1b, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+    void putShort(unsigned char *p, unsigned int value)
+    {
+        p[0] = value & 0xff;
+        p[1] = (value >> 8) & 0xff;
+    }
+
+    void putInt(unsigned char *p, unsigned int value)
+    {
+        putShort(p, value & 0xffff);
+        putShort(p + 2, value >> 16);
+    }
+
+    bool initStream(z_stream &stream, int level)
+    {
+        memset(&stream, 0, sizeof(stream));
+        // raw deflate, the BGZF header and footer are written by hand
+        return deflateInit2(&stream, level, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) == Z_OK;
+    }
+}
+
+CompressedOutput::CompressedOutput()
+{
+    fout = NULL;
+    failed = false;
+    level = Z_DEFAULT_COMPRESSION;
+    head = tail = claimed = 0;
+    threadCount = 1;
+    streamOpen = false;
+    stopping = false;
+}
+
+CompressedOutput::~CompressedOutput()
+{
+    Close();
+}
+
+bool CompressedOutput::Open(const string &filename, bool append, int threads, int level)
+{
+    if (fout != NULL)
+        return false;
+    fout = fopen(filename.c_str(), append ? "ab" : "wb");
+    if (fout == NULL)
+        return false;
+    failed = false;
+    this->level = level;
+    current.clear();
+    current.reserve(BlockSize);
+
+    threadCount = threads > 0 ? threads : TaskScheduler::GetThreadCount();
+    if (threadCount < 1)
+        threadCount = 1;
+    slots.resize(max(2 * BlocksPerThread, threadCount * BlocksPerThread));
+    head = tail = claimed = 0;
+    if (threadCount <= 1)
+    {
+        streamOpen = initStream(stream, level);
+        if (!streamOpen)
+        {
+            fclose(fout);
+            fout = NULL;
+            return false;
+        }
+    }
+    startWorkers();
+    return true;
+}
+
+bool CompressedOutput::Close()
+{
+    if (fout == NULL)
+        return false;
+    if (!current.empty())
+        submitBlock();
+    drain(tail);
+    stopWorkers();
+    slots.clear();
+    if (streamOpen)
+        deflateEnd(&stream);
+    streamOpen = false;
+
+    if (!failed && fwrite(EOFBlock, 1, sizeof(EOFBlock), fout) != sizeof(EOFBlock))
+        failed = true;
+    if (fclose(fout) != 0)
+        failed = true;
+    fout = NULL;
+    return !failed;
+}
+
+bool CompressedOutput::Write(const char *data, size_t size)
+{
+    if (fout == NULL)
+        return false;
+    while (size > 0)
+    {
+        size_t n = min(size, BlockSize - current.size());
+        current.insert(current.end(), data, data + n);
+        data += n;
+        size -= n;
+        if (current.size() == BlockSize && !submitBlock())
+            return false;
+    }
+    return !failed;
+}
+
+bool CompressedOutput::Submit(vector<char> &buffer)
+{
+    bool result = buffer.empty() || Write(&buffer[0], buffer.size());
+    buffer.clear();
+    return result;
+}
+
+bool CompressedOutput::submitBlock()
+{
+    // the oldest block has to be written before its slot can be reused
+    if (tail - head >= (long long)slots.size())
+        drain(tail - slots.size() + 1);
+
+    Block &block = slots[tail % slots.size()];
+    block.Data.swap(current);
+    current.clear();
+    block.Ready = false;
+    block.Failed = false;
+    if (workers.empty())
+    {
+        block.Failed = !compressBlock(block, stream);
+        block.Ready = true;
+        tail++;
+        claimed = tail;
+    }
+    else
+    {
+        {
+            lock_guard<mutex> guard(lock);
+            tail++;
+        }
+        workAvailable.notify_one();
+    }
+    drain(head);
+    return !failed;
+}
+
+// writes blocks in order, waiting for the compression of all blocks before until,
+// and of any block after it that is already finished
+void CompressedOutput::drain(long long until)
+{
+    while (head < tail)
+    {
+        Block &block = slots[head % slots.size()];
+        {
+            unique_lock<mutex> guard(lock);
+            if (!block.Ready && head >= until)
+                return;
+            while (!block.Ready)
+                blockReady.wait(guard);
+        }
+
+        if (block.Failed)
+            failed = true;
+        else if (!failed && fwrite(&block.Compressed[0], 1, block.Compressed.size(), fout) != block.Compressed.size())
+            failed = true;
+        head++;
+    }
+}
+
+bool CompressedOutput::compressBlock(Block &block, z_stream &stream)
+{
+    size_t size = block.Data.size();
+    block.Compressed.resize(BGZFMaxBlockSize);
+    unsigned char *out = &block.Compressed[0];
+
+    if (deflateReset(&stream) != Z_OK)
+        return false;
+    stream.next_in = (Bytef *)block.Data.data();
+    stream.avail_in = size;
+    stream.next_out = out + BGZFHeaderSize;
+    stream.avail_out = BGZFMaxBlockSize - BGZFHeaderSize - BGZFFooterSize;
+    int ret = deflate(&stream, Z_FINISH);
+    size_t compressedSize;
+    if (ret == Z_STREAM_END)
+        compressedSize = stream.total_out;
+    else if (ret == Z_OK || ret == Z_BUF_ERROR)
+    {
+        // incompressible data, fall back on a single stored deflate block
+        unsigned char *p = out + BGZFHeaderSize;
+        p[0] = 1;
+        putShort(p + 1, size);
+        putShort(p + 3, ~size & 0xffff);
+        if (size > 0)
+            memcpy(p + 5, block.Data.data(), size);
+        compressedSize = size + 5;
+    }
+    else
+        return false;
+
+    size_t blockSize = BGZFHeaderSize + compressedSize + BGZFFooterSize;
+    static const unsigned char header[16] = { 0x1f, 0x8b, 8, 4, 0, 0, 0, 0, 0, 0xff, 6, 0, 'B', 'C', 2, 0 };
+    memcpy(out, header, sizeof(header));
+    putShort(out + 16, blockSize - 1);
+    unsigned char *footer = out + BGZFHeaderSize + compressedSize;
+    putInt(footer, crc32(crc32(0L, Z_NULL, 0), (const Bytef *)block.Data.data(), size));
+    putInt(footer + 4, size);
+    block.Compressed.resize(blockSize);
+    return true;
+}
+
+void CompressedOutput::startWorkers()
+{
+    stopping = false;
+    // a single thread compresses the blocks itself when they are submitted
+    if (threadCount <= 1)
+        return;
+    for (int i = 0; i < threadCount; i++)
+        workers.push_back(thread(&CompressedOutput::worker, this));
+}
+
+void CompressedOutput::stopWorkers()
+{
+    {
+        lock_guard<mutex> guard(lock);
+        stopping = true;
+    }
+    workAvailable.notify_all();
+    for (size_t i = 0; i < workers.size(); i++)
+        workers[i].join();
+    workers.clear();
+}
+
+void CompressedOutput::worker()
+{
+    z_stream stream;
+    bool initialized = initStream(stream, level);
+    while (true)
+    {
+        long long index;
+        {
+            unique_lock<mutex> guard(lock);
+            while (!stopping && claimed >= tail)
+                workAvailable.wait(guard);
+            if (stopping)
+                break;
+            index = claimed++;
+        }
+
+        Block &block = slots[index % slots.size()];
+        bool compressed = initialized && compressBlock(block, stream);
+        {
+            lock_guard<mutex> guard(lock);
+            block.Failed = !compressed;
+            block.Ready = true;
+        }
+        blockReady.notify_all();
+    }
+    if (initialized)
+        deflateEnd(&stream);
+}
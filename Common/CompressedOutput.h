@@ -0,0 +1,103 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+/*
+ * BGZF compressed file output. Data is cut into independent blocks of at most
+ * BlockSize bytes, which are deflated by a pool of worker threads and written
+ * to the file in submission order. The result is a valid gzip file that can be
+ * indexed and read in parallel.
+ */
+
+#ifndef _COMPRESSEDOUTPUT_H
+#define _COMPRESSEDOUTPUT_H
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <zlib.h>
+
+using namespace std;
+
+class CompressedOutput
+{
+public:
+    // uncompressed bytes per block, leaves room for incompressible data within the 64KB limit
+    static const size_t BlockSize = 0xff00;
+
+public:
+    CompressedOutput();
+    virtual ~CompressedOutput();
+
+    // threads <= 0 uses the process thread budget, level is the zlib compression level
+    bool Open(const string &filename, bool append = false, int threads = 0, int level = Z_DEFAULT_COMPRESSION);
+    // compresses and writes all remaining data and the end-of-file marker, false if anything failed
+    bool Close();
+    bool IsOpen() const { return fout != NULL; }
+    bool Failed() const { return failed; }
+    bool Write(const char *data, size_t size);
+    // writes the contents of buffer and leaves it empty
+    bool Submit(vector<char> &buffer);
+
+private:
+    struct Block
+    {
+        vector<char> Data;
+        vector<unsigned char> Compressed;
+        bool Ready;
+        bool Failed;
+    };
+
+    bool submitBlock();
+    void drain(long long until);
+    bool compressBlock(Block &block, z_stream &stream);
+    void startWorkers();
+    void stopWorkers();
+    void worker();
+
+private:
+    FILE *fout;
+    bool failed;
+    int level;
+    vector<char> current;
+
+    // ring of blocks, indices grow monotonically
+    vector<Block> slots;
+    long long head, tail, claimed;
+    vector<thread> workers;
+    int threadCount;
+    z_stream stream;
+    bool streamOpen;
+    mutex lock;
+    condition_variable workAvailable, blockReady;
+    bool stopping;
+};
+
+#endif
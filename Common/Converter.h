@@ -1,53 +1,64 @@
-/*
- * Common : a collection of classes (re)used throughout the scaffolder implementation.
- * Copyright (C) 2011  Alexey Gritsenko
- * 
- * This program is free software: you can redistribute it and/or modify
- * it under the terms of the GNU General Public License as published by
- * the Free Software Foundation, either version 3 of the License, or
- * (at your option) any later version.
- *
- * This program is distributed in the hope that it will be useful,
- * but WITHOUT ANY WARRANTY; without even the implied warranty of
- * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- * GNU General Public License for more details.
- *
- * You should have received a copy of the GNU General Public License
- * along with this program.  If not, see http://www.gnu.org/licenses/.
- * 
- * 
- * 
- * Email: a.gritsenko@tudelft.nl
- * Mail: Delft University of Technology
- *       Faculty of Electrical Engineering, Mathematics, and Computer Science
- *       Department of Mediamatics
- *       P.O. Box 5031
- *       2600 GA, Delft, The Netherlands
- */
-
-
-#ifndef _CONVERTER_H
-#define _CONVERTER_H
-
-#include "AlignerConfiguration.h"
-#include <string>
-
-using namespace std;
-
-class Converter
-{
-public:
-	Converter(const string &inputFileName, const SAMToolsConfiguration &config)
-		: InputFileName(inputFileName), Configuration(config), RemoveOutput(true) {};
-	virtual ~Converter();
-
-public:
-	bool Convert(const string &outputFileName = (char *)"" ,bool removeAfterConversion = true);
-
-public:
-	const string InputFileName;
-	string OutputFileName;
-	SAMToolsConfiguration Configuration;
-	bool RemoveOutput;
-};
-#endif
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+
+#ifndef _CONVERTER_H
+#define _CONVERTER_H
+
+#include "AlignerConfiguration.h"
+#include "ProcessRunner.h"
+#include <string>
+#include <vector>
+
+using namespace std;
+
+class Converter
+{
+public:
+	Converter(const string &inputFileName, const SAMToolsConfiguration &config)
+		: InputFileName(inputFileName), Configuration(config), RemoveOutput(true) {};
+	virtual ~Converter();
+
+public:
+	bool Convert(const string &outputFileName = (char *)"" ,bool removeAfterConversion = true);
+
+public:
+	// Converts into temporary files running up to `concurrent` conversions at once; returns the index of the first failed converter or -1.
+	static int ConvertAll(const vector<Converter *> &converters, int concurrent, bool removeAfterConversion = true);
+
+public:
+	const string InputFileName;
+	string OutputFileName;
+	SAMToolsConfiguration Configuration;
+	bool RemoveOutput;
+	ProcessStats Stats;
+
+private:
+	void prepare(const string &outputFileName, ProcessJob &job);
+	bool finish(ProcessJob &job, bool removeAfterConversion);
+};
+#endif
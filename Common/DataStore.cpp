@@ -1,438 +1,816 @@
-/*
- * Common : a collection of classes (re)used throughout the scaffolder implementation.
- * Copyright (C) 2011  Alexey Gritsenko
- * 
- * This program is free software: you can redistribute it and/or modify
- * it under the terms of the GNU General Public License as published by
- * the Free Software Foundation, either version 3 of the License, or
- * (at your option) any later version.
- *
- * This program is distributed in the hope that it will be useful,
- * but WITHOUT ANY WARRANTY; without even the implied warranty of
- * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- * GNU General Public License for more details.
- *
- * You should have received a copy of the GNU General Public License
- * along with this program.  If not, see http://www.gnu.org/licenses/.
- * 
- * 
- * 
- * Email: a.gritsenko@tudelft.nl
- * Mail: Delft University of Technology
- *       Faculty of Electrical Engineering, Mathematics, and Computer Science
- *       Department of Mediamatics
- *       P.O. Box 5031
- *       2600 GA, Delft, The Netherlands
- */
-
-
-#include "DataStore.h"
-#include "Reader.h"
-#include "Helpers.h"
-#include <string>
-#include <utility>
-#include <algorithm>
-#include <set>
-
-#include <iostream>
-
-using namespace std;
-
-int Contig::GetID() const
-{
-	return id;
-}
-
-ContigLink::ContigLink(int first, int second, double mean, double std, bool equalOrientation, bool forwardOrder, double weight, const string &comment)
-	: First(first), Second(second), Mean(mean), Std(std), EqualOrientation(equalOrientation), ForwardOrder(forwardOrder), Weight(weight), Ambiguous(false), Comment(comment), groupId(0)
-{
-}
-
-bool ContigLink::operator< (const ContigLink &other)
-{
-	if (First < other.First)
-		return true;
-	if (First > other.First)
-		return false;
-	if (Second < other.Second)
-		return true;
-	if (Second > other.Second)
-		return false;
-	return false;
-}
-
-int ContigLink::GetGroupID() const
-{
-	return groupId;
-}
-
-int LinkGroup::GetID() const
-{
-	return id;
-}
-
-const Contig &DataStore::operator[] (int i) const
-{
-	return contigs[i];
-}
-
-const DataStore::LinkRange DataStore::operator() (int i, int j) const
-{
-	pair<int,int> query(i, j);
-	return links.equal_range(query);
-}
-
-DataStore::LinkMap::const_iterator DataStore::Begin() const
-{
-	return links.begin();
-}
-
-DataStore::LinkMap::const_iterator DataStore::End() const
-{
-	return links.end();
-}
-
-DataStore::LinkMap::iterator DataStore::Begin()
-{
-	return links.begin();
-}
-
-DataStore::LinkMap::iterator DataStore::End()
-{
-	return links.end();
-}
-
-const LinkGroup &DataStore::GetGroup(int id) const
-{
-	return groups[id];
-}
-
-vector<FastASequence> DataStore::GetContigs() const
-{
-    vector<FastASequence> faContigs(ContigCount);
-    for (int i = 0; i < ContigCount; i++)
-        faContigs[i] = contigs[i].Sequence;
-    return faContigs;
-}
-
-int DataStore::AddContig(const Contig &contig)
-{
-	contigs.push_back(contig);
-	int id = contigs[ContigCount].id = ContigCount++;
-	return id;
-}
-
-int DataStore::AddGroup(const LinkGroup &group)
-{
-	groups.push_back(group);
-	return groups[GroupCount].id = GroupCount++;
-}
-
-DataStore::LinkMap::const_iterator DataStore::AddLink(int groupId, const ContigLink &link)
-{
-	if (groupId >= GroupCount)
-		throw exception();
-	LinkCount++;
-	//fprintf(stderr, "Linked: d(%i,%i) = %8.2f; orientation: %8s; order: %7s.\n", link.First, link.Second, link.Mean, (link.EqualOrientation ? "equal" : "opposite"), (link.ForwardOrder ? "forward" : "reverse"));
-	pair<int,int> query(link.First, link.Second);
-	LinkMap::iterator it = links.insert(pair<pair<int,int>,ContigLink>(query, link));
-	it->second.groupId = groupId;
-	return it;
-}
-
-bool DataStore::ReadContigs(const string &fileName)
-{
-	FastAReader reader;
-	FastASequence seq;
-	if (!reader.Open(fileName))
-		return false;
-	
-	int read = 0;
-	while (reader.Read(seq))
-	{
-		Contig contig(seq);
-		AddContig(contig);
-		read++;
-	}
-	reader.Close();
-	return read != 0;
-}
-
-void DataStore::Sort()
-{
-	vector<ContigLink> vec;
-	for (LinkMap::iterator it = links.begin(); it != links.end(); it++)
-	{
-		if (it->first.first > it->first.second)
-		{
-			swap(it->second.First, it->second.Second);
-			it->second.ForwardOrder ^= it->second.EqualOrientation;
-		}
-		vec.push_back(it->second);
-	}
-	links.clear();
-	for (vector<ContigLink>::iterator it = vec.begin(); it != vec.end(); it++)
-	{
-		pair<int, int> pos(it->First, it->Second);
-		links.insert(pair<pair<int,int>,ContigLink>(pos, *it));
-	}
-}
-
-void DataStore::Bundle(bool sortLinks, bool perGroup, bool joinAmbiguous, double distance)
-{
-	if (sortLinks)
-		Sort();
-
-	vector<ContigLink> vec;
-	vector< vector<ContigLink> > space;
-	for (LinkMap::iterator it = links.begin(), start = links.begin(); it != links.end(); it++)
-	{
-		vec.clear();
-		while (it != links.end() && it->first == start->first)
-		{
-			vec.push_back(it->second);
-			it++;
-		}
-		start = it--;
-		space.push_back(vec);
-	}
-	links.clear();
-	for (vector< vector<ContigLink> >::iterator it = space.begin(); it != space.end(); it++)
-		bundleLinks(*it, perGroup, joinAmbiguous, distance);
-}
-
-// remove nested loop
-void DataStore::Extract(const vector<int> &what, DataStore &store, vector<int> &transBack)
-{
-	vector<int> transContig(ContigCount, -1);
-	vector<int> transGroup(GroupCount, -1);
-	int nWhat = what.size();
-	transBack.resize(nWhat, -1);
-	for (int i = 0; i < nWhat; i++)
-	{
-		int id = store.AddContig(contigs[what[i]]);
-		transContig[what[i]] = id;
-		transBack[id] = what[i];
-	}
-	for (int i = 0; i < nWhat; i++)
-		for (int j = 0; j < nWhat; j++)
-		{
-			LinkRange range = (*this)(what[i], what[j]);
-			for (LinkMap::const_iterator it = range.first; it != range.second; it++)
-			{
-				int groupId = it->second.GetGroupID();
-				if (transGroup[groupId] < 0)
-					transGroup[groupId] = store.AddGroup(this->GetGroup(groupId));
-				ContigLink link(transContig[what[i]], transContig[what[j]], it->second.Mean, it->second.Std, it->second.EqualOrientation, it->second.ForwardOrder, it->second.Weight);
-				link.Ambiguous = it->second.Ambiguous;
-				store.AddLink(transGroup[groupId], link);
-			}
-		}
-}
-
-int DataStore::RemoveAmbiguous()
-{
-	vector<ContigLink> keep;
-	int count = 0;
-	for (LinkMap::iterator it = links.begin(); it != links.end(); it++)
-		if (!it->second.Ambiguous)
-			keep.push_back(it->second);
-		else
-			count++;
-	links.clear();
-	for (vector<ContigLink>::iterator it = keep.begin(); it != keep.end(); it++)
-	{
-		pair<int, int> pos(it->First, it->Second);
-		links.insert(pair<pair<int,int>,ContigLink>(pos, *it));
-	}
-	return count;
-}
-
-int DataStore::Erode(double weight)
-{
-	vector<ContigLink> keep;
-	int count = 0;
-	for (LinkMap::iterator it = links.begin(); it != links.end(); it++)
-		if (it->second.Weight - weight > - Helpers::Eps)
-			keep.push_back(it->second);
-		else
-			count++;
-	links.clear();
-	for (vector<ContigLink>::iterator it = keep.begin(); it != keep.end(); it++)
-	{
-		pair<int, int> pos(it->First, it->Second);
-		links.insert(pair<pair<int,int>,ContigLink>(pos, *it));
-	}
-	return count;
-}
-
-int DataStore::IsolateContigs(const vector<int> &ids)
-{
-    vector<ContigLink> keep;
-    int count = 0;
-    for (LinkMap::const_iterator it = links.begin(); it != links.end(); it++)
-    {
-        bool shouldKeep = true;
-        for (vector<int>::const_iterator id = ids.begin(); id != ids.end(); id++)
-            if (it->first.first == *id || it->first.second == *id)
-            {
-                shouldKeep = false;
-                break;
-            }
-        if (shouldKeep)
-            keep.push_back(it->second);
-        else
-            count++;
-    }
-    links.clear();
-    for (vector<ContigLink>::iterator it = keep.begin(); it != keep.end(); it++)
-    {
-        pair<int, int> pos(it->First, it->Second);
-        links.insert(pair<pair<int,int>,ContigLink>(pos, *it));
-    }
-    return count;
-}
-
-/*void DataStore::temp()
-{
-	vector<ContigLink> newStore;
-	LinkMap::iterator start = links.begin();
-	for (LinkMap::iterator it = links.begin(); it != links.end(); it++)
-	{
-		LinkMap::iterator maxIt = start;
-		while (it != links.end() && it->first == start->first)
-		{
-			if (it->second.Weight > maxIt->second.Weight)
-				maxIt = it;
-			it++;
-		}
-		newStore.push_back(maxIt->second);
-		start = it--;
-	}
-	links.clear();
-	for (vector<ContigLink>::iterator it = newStore.begin(); it != newStore.end(); it++)
-		links.insert(pair<pair<int,int>, ContigLink>(pair<int,int>(it->First, it->Second), *it));
-}*/
-
-void DataStore::bundleLinks(vector<ContigLink> &l, bool perGroup, bool joinAmbiguous, double distance)
-{
-	if (perGroup && joinAmbiguous)
-		sort(l.begin(), l.end(), linkComparerGroup);
-	else if (perGroup && !joinAmbiguous)
-		sort(l.begin(), l.end(), linkComparerAmbiguousGroup);
-	else if (!perGroup && joinAmbiguous)
-		sort(l.begin(), l.end(), linkComparer);
-	else
-		sort(l.begin(), l.end(), linkComparerAmbiguous);
-	int s = 0;
-	vector<ContigLink> sel;
-	while (selectGroup(l, perGroup, joinAmbiguous, s, sel))
-		while (sel.size() > 0)
-			performBundle(sel, distance);
-}
-
-void DataStore::performBundle(vector<ContigLink> &l, double distance)
-{
-	vector<ContigLink> r;
-	set<int> groupIds;
-	int n = l.size(), m = (n % 2 == 1 ? n / 2 : n / 2 - 1);
-	if (n == 0) return;
-	double p = 0, q = 0, w = 0;
-	bool ambiguous = false;
-	string comment;
-	for (int i = 0; i < n; i++)
-		if (abs(l[i].Mean - l[m].Mean) < distance * l[m].Std)
-		{
-			p += l[i].Mean / (l[i].Std * l[i].Std);
-			q += 1 / (l[i].Std * l[i].Std);
-			w += l[i].Weight;
-			ambiguous = ambiguous || l[i].Ambiguous;
-			if (l[i].Comment.length() > 0)
-			{
-				if (comment.length() == 0)
-					comment = l[i].Comment;
-				else
-					comment += "|" + l[i].Comment;
-			}
-			groupIds.insert(l[i].GetGroupID());
-		}
-		else r.push_back(l[i]);
-	ContigLink link(l[m].First, l[m].Second, p / q, 1 / sqrt(q), l[m].EqualOrientation, l[m].ForwardOrder, w, comment);
-	link.Ambiguous = ambiguous;
-	int groupId;
-	if (groupIds.size() > 1)
-	{
-		string name;
-		string description = "Group for bundle-links joining several groups.";
-		for (set<int>::iterator it = groupIds.begin(); it != groupIds.end(); it++)
-			name = name + "+" + Helpers::ItoStr(*it);
-		groupId = AddGroup(LinkGroup(name, description));
-	}
-	else
-		groupId = *groupIds.begin();
-	AddLink(groupId, link);
-	l.clear();
-	l.insert(l.begin(), r.begin(), r.end());
-}
-
-bool DataStore::linkComparerAmbiguous(const ContigLink &a, const ContigLink &b)
-{
-	if (!a.EqualOrientation && b.EqualOrientation)
-		return true;
-	if (a.EqualOrientation && !b.EqualOrientation)
-		return false;
-	if (!a.ForwardOrder && b.ForwardOrder)
-		return true;
-	if (a.ForwardOrder && !b.ForwardOrder)
-		return false;
-	if (!a.Ambiguous && b.Ambiguous)
-		return true;
-	if (a.Ambiguous && !b.Ambiguous)
-		return false;
-	return a.Mean < b.Mean;
-}
-
-bool DataStore::linkComparer(const ContigLink &a, const ContigLink &b)
-{
-	if (!a.EqualOrientation && b.EqualOrientation)
-		return true;
-	if (a.EqualOrientation && !b.EqualOrientation)
-		return false;
-	if (!a.ForwardOrder && b.ForwardOrder)
-		return true;
-	if (a.ForwardOrder && !b.ForwardOrder)
-		return false;
-	return a.Mean < b.Mean;
-}
-
-bool DataStore::linkComparerGroup(const ContigLink &a, const ContigLink &b)
-{
-	if (a.GetGroupID() < b.GetGroupID())
-		return true;
-	if (a.GetGroupID() > b.GetGroupID())
-		return false;
-	return linkComparer(a, b);
-}
-
-bool DataStore::linkComparerAmbiguousGroup(const ContigLink &a, const ContigLink &b)
-{
-	if (a.GetGroupID() < b.GetGroupID())
-		return true;
-	if (a.GetGroupID() > b.GetGroupID())
-		return false;
-	return linkComparerAmbiguous(a, b);
-}
-
-bool DataStore::selectGroup(vector<ContigLink> &l, bool perGroup, bool joinAmbiguous, int &s, vector<ContigLink> &selection)
-{
-	int i = s;
-	int n = l.size();
-	if (i >= n)
-		return false;
-	s++;
-	selection.clear();
-	selection.push_back(l[i]);
-	while (s < n && ((!perGroup || l[i].GetGroupID() == l[s].GetGroupID()) && l[i].EqualOrientation == l[s].EqualOrientation && l[i].ForwardOrder == l[s].ForwardOrder && (joinAmbiguous || l[i].Ambiguous == l[s].Ambiguous)))
-		selection.push_back(l[s++]);
-	return true;
-}
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+
+#include "DataStore.h"
+#include "MappedReader.h"
+#include "Helpers.h"
+#include "Profiler.h"
+#include <string>
+#include <utility>
+#include <algorithm>
+#include <set>
+
+#include <iostream>
+
+using namespace std;
+
+int Contig::GetID() const
+{
+	return id;
+}
+
+ContigLink::ContigLink(int first, int second, double mean, double std, bool equalOrientation, bool forwardOrder, double weight, const string &comment)
+	: First(first), Second(second), Mean(mean), Std(std), EqualOrientation(equalOrientation), ForwardOrder(forwardOrder), Weight(weight), Ambiguous(false), Comment(comment), groupId(0)
+{
+}
+
+bool ContigLink::operator< (const ContigLink &other)
+{
+	if (First < other.First)
+		return true;
+	if (First > other.First)
+		return false;
+	if (Second < other.Second)
+		return true;
+	if (Second > other.Second)
+		return false;
+	return false;
+}
+
+int ContigLink::GetGroupID() const
+{
+	return groupId;
+}
+
+int LinkGroup::GetID() const
+{
+	return id;
+}
+
+namespace
+{
+	const string emptyComment;
+
+	template <class T>
+	void permute(vector<T> &column, const vector<int> &order)
+	{
+		vector<T> permuted;
+		permuted.reserve(order.size());
+		for (vector<int>::const_iterator it = order.begin(); it != order.end(); it++)
+			permuted.push_back(column[*it]);
+		column.swap(permuted);
+	}
+
+	template <class T>
+	void compact(vector<T> &column, const vector<char> &keep)
+	{
+		int n = 0, size = column.size();
+		for (int k = 0; k < size; k++)
+			if (keep[k])
+				column[n++] = column[k];
+		column.resize(n);
+	}
+
+	// Calls visit(k, a, b) for every link k between two contigs of what, a and b being their positions
+	// in what. Links come by position of the first contig, then of the second, then in table order.
+	template <class Visit>
+	void visitLinksAmong(const LinkTable &links, const vector<int> &what, Visit visit)
+	{
+		int n = what.size();
+		vector< pair<int,int> > positions(n);
+		for (int i = 0; i < n; i++)
+			positions[i] = make_pair(what[i], i);
+		sort(positions.begin(), positions.end());
+		vector< pair<int,int> > row;
+		for (int i = 0; i < n; i++)
+		{
+			row.clear();
+			for (int k = links.OutBegin(what[i]), end = links.OutEnd(what[i]); k < end; k++)
+			{
+				int second = links.Second(k);
+				vector< pair<int,int> >::const_iterator it = lower_bound(positions.begin(), positions.end(), make_pair(second, -1));
+				for (; it != positions.end() && it->first == second; it++)
+					row.push_back(make_pair(it->second, k));
+			}
+			stable_sort(row.begin(), row.end(), [](const pair<int,int> &x, const pair<int,int> &y) { return x.first < y.first; });
+			for (vector< pair<int,int> >::const_iterator it = row.begin(); it != row.end(); it++)
+				visit(it->second, i, it->first);
+		}
+	}
+}
+
+const string &LinkTable::Comment(int k) const
+{
+	return linkComment[k] < 0 ? emptyComment : comments[linkComment[k]];
+}
+
+ContigLink LinkTable::Get(int k) const
+{
+	ContigLink link;
+	Get(k, link);
+	return link;
+}
+
+void LinkTable::Get(int k, ContigLink &link) const
+{
+	link.First = linkFirst[k];
+	link.Second = linkSecond[k];
+	link.Mean = linkMean[k];
+	link.Std = linkStd[k];
+	link.EqualOrientation = EqualOrientation(k);
+	link.ForwardOrder = ForwardOrder(k);
+	link.Weight = linkWeight[k];
+	link.Ambiguous = Ambiguous(k);
+	link.Comment = Comment(k);
+	link.groupId = linkGroup[k];
+}
+
+// links between i and j are a run of contig i's row, ordered by second contig
+pair<int,int> LinkTable::Find(int i, int j) const
+{
+	const int *row = linkSecond.data();
+	pair<const int *, const int *> range = equal_range(row + OutBegin(i), row + OutEnd(i), j);
+	return make_pair((int)(range.first - row), (int)(range.second - row));
+}
+
+void LinkTable::Reserve(int n)
+{
+	linkFirst.reserve(n);
+	linkSecond.reserve(n);
+	linkGroup.reserve(n);
+	linkMean.reserve(n);
+	linkStd.reserve(n);
+	linkWeight.reserve(n);
+	linkFlags.reserve(n);
+	linkComment.reserve(n);
+}
+
+void LinkTable::Append(const ContigLink &link, int groupId)
+{
+	appendKey(link.First, link.Second);
+	linkGroup.push_back(groupId);
+	linkMean.push_back(link.Mean);
+	linkStd.push_back(link.Std);
+	linkWeight.push_back(link.Weight);
+	linkFlags.push_back((link.EqualOrientation ? EqualOrientationFlag : 0) | (link.ForwardOrder ? ForwardOrderFlag : 0) | (link.Ambiguous ? AmbiguousFlag : 0));
+	// most links carry no comment, those that do share a side table
+	if (link.Comment.empty())
+		linkComment.push_back(-1);
+	else
+	{
+		linkComment.push_back(comments.size());
+		comments.push_back(link.Comment);
+	}
+}
+
+// copies link k of source, renumbering its contigs to first and second
+void LinkTable::Append(const LinkTable &source, int k, int first, int second)
+{
+	appendKey(first, second);
+	linkGroup.push_back(source.linkGroup[k]);
+	linkMean.push_back(source.linkMean[k]);
+	linkStd.push_back(source.linkStd[k]);
+	linkWeight.push_back(source.linkWeight[k]);
+	linkFlags.push_back(source.linkFlags[k]);
+	if (source.linkComment[k] < 0)
+		linkComment.push_back(-1);
+	else
+	{
+		linkComment.push_back(comments.size());
+		comments.push_back(source.comments[source.linkComment[k]]);
+	}
+}
+
+// appends a whole batch with one insert per column
+void LinkTable::Append(LinkColumns &columns)
+{
+	int n = Size(), count = columns.Count;
+	if (count <= 0)
+		return;
+	int first = n > 0 ? linkFirst[n - 1] : columns.First[0], second = n > 0 ? linkSecond[n - 1] : columns.Second[0];
+	for (int k = 0; k < count && sorted; k++)
+	{
+		if (columns.First[k] < first || (columns.First[k] == first && columns.Second[k] < second))
+			sorted = false;
+		first = columns.First[k];
+		second = columns.Second[k];
+	}
+	indexed = false;
+	linkFirst.insert(linkFirst.end(), columns.First, columns.First + count);
+	linkSecond.insert(linkSecond.end(), columns.Second, columns.Second + count);
+	linkGroup.insert(linkGroup.end(), columns.Groups, columns.Groups + count);
+	linkMean.insert(linkMean.end(), columns.Mean, columns.Mean + count);
+	linkStd.insert(linkStd.end(), columns.Std, columns.Std + count);
+	linkWeight.insert(linkWeight.end(), columns.Weight, columns.Weight + count);
+	linkFlags.insert(linkFlags.end(), columns.Flags, columns.Flags + count);
+	linkComment.resize(n + count, -1);
+	comments.reserve(comments.size() + columns.CommentCount);
+	for (int c = 0; c < columns.CommentCount; c++)
+	{
+		linkComment[n + columns.CommentRows[c]] = comments.size();
+		comments.push_back(string());
+		comments.back().swap(columns.Comments[c]);
+	}
+}
+
+// turns link k around so that it reads from its second contig to its first
+void LinkTable::Flip(int k)
+{
+	swap(linkFirst[k], linkSecond[k]);
+	if (EqualOrientation(k))
+		linkFlags[k] ^= ForwardOrderFlag;
+	sorted = indexed = false;
+}
+
+// drops the links not marked in keep, the remaining ones keep their order
+int LinkTable::Keep(const vector<char> &keep)
+{
+	int n = Size();
+	vector<string> keptComments;
+	for (int k = 0; k < n; k++)
+		if (keep[k] && linkComment[k] >= 0)
+		{
+			keptComments.push_back(string());
+			keptComments.back().swap(comments[linkComment[k]]);
+			linkComment[k] = keptComments.size() - 1;
+		}
+	comments.swap(keptComments);
+	compact(linkFirst, keep);
+	compact(linkSecond, keep);
+	compact(linkGroup, keep);
+	compact(linkMean, keep);
+	compact(linkStd, keep);
+	compact(linkWeight, keep);
+	compact(linkFlags, keep);
+	compact(linkComment, keep);
+	indexed = false;
+	return n - Size();
+}
+
+void LinkTable::Clear()
+{
+	LinkTable().Swap(*this);
+}
+
+void LinkTable::Swap(LinkTable &other)
+{
+	linkFirst.swap(other.linkFirst);
+	linkSecond.swap(other.linkSecond);
+	linkGroup.swap(other.linkGroup);
+	linkMean.swap(other.linkMean);
+	linkStd.swap(other.linkStd);
+	linkWeight.swap(other.linkWeight);
+	linkFlags.swap(other.linkFlags);
+	linkComment.swap(other.linkComment);
+	comments.swap(other.comments);
+	swap(sorted, other.sorted);
+	swap(indexed, other.indexed);
+	swap(contigs, other.contigs);
+	outOffsets.swap(other.outOffsets);
+	inOffsets.swap(other.inOffsets);
+	inLinks.swap(other.inLinks);
+}
+
+void LinkTable::appendKey(int first, int second)
+{
+	int n = Size();
+	if (n > 0 && (first < linkFirst[n - 1] || (first == linkFirst[n - 1] && second < linkSecond[n - 1])))
+		sorted = false;
+	indexed = false;
+	linkFirst.push_back(first);
+	linkSecond.push_back(second);
+}
+
+void LinkTable::Finalize()
+{
+	if (!sorted)
+		sortRows();
+	if (!indexed)
+		buildIndex();
+}
+
+// a stable sort keeps links of the same contig pair in the order they were added
+void LinkTable::sortRows()
+{
+	int n = Size();
+	vector<int> order(n);
+	for (int k = 0; k < n; k++)
+		order[k] = k;
+	const vector<int> &f = linkFirst, &s = linkSecond;
+	stable_sort(order.begin(), order.end(), [&](int a, int b) { return f[a] < f[b] || (f[a] == f[b] && s[a] < s[b]); });
+	permute(linkFirst, order);
+	permute(linkSecond, order);
+	permute(linkGroup, order);
+	permute(linkMean, order);
+	permute(linkStd, order);
+	permute(linkWeight, order);
+	permute(linkFlags, order);
+	permute(linkComment, order);
+	sorted = true;
+}
+
+// both adjacencies are built by counting, the reverse one visits the rows in order so that its runs are ordered by first contig
+void LinkTable::buildIndex()
+{
+	int n = Size();
+	contigs = 0;
+	for (int k = 0; k < n; k++)
+		contigs = max(contigs, max(linkFirst[k], linkSecond[k]) + 1);
+	outOffsets.assign(contigs + 1, 0);
+	inOffsets.assign(contigs + 1, 0);
+	for (int k = 0; k < n; k++)
+	{
+		outOffsets[linkFirst[k] + 1]++;
+		inOffsets[linkSecond[k] + 1]++;
+	}
+	for (int i = 0; i < contigs; i++)
+	{
+		outOffsets[i + 1] += outOffsets[i];
+		inOffsets[i + 1] += inOffsets[i];
+	}
+	vector<int> next(inOffsets.begin(), inOffsets.end() - 1);
+	inLinks.resize(n);
+	for (int k = 0; k < n; k++)
+		inLinks[next[linkSecond[k]]++] = k;
+	indexed = true;
+}
+
+const Contig &DataStore::operator[] (int i) const
+{
+	return contigs[i];
+}
+
+// links added since the last FinalizeLinks are not visible to queries yet
+const LinkTable &DataStore::Links() const
+{
+	if (!links.IsFinalized())
+		throw exception();
+	return links;
+}
+
+const LinkGroup &DataStore::GetGroup(int id) const
+{
+	return groups[id];
+}
+
+vector<FastASequence> DataStore::GetContigs() const
+{
+    vector<FastASequence> faContigs(ContigCount);
+    for (int i = 0; i < ContigCount; i++)
+        contigs[i].Sequence.Unpack(faContigs[i]);
+    return faContigs;
+}
+
+int DataStore::AddContig(const Contig &contig)
+{
+	contigs.push_back(contig);
+	int id = contigs[ContigCount].id = ContigCount;
+	ContigCount++;
+	return id;
+}
+
+int DataStore::AddGroup(const LinkGroup &group)
+{
+	groups.push_back(group);
+	int id = groups[GroupCount].id = GroupCount;
+	GroupCount++;
+	return id;
+}
+
+void DataStore::AddLink(int groupId, const ContigLink &link)
+{
+	if (groupId >= GroupCount)
+		throw exception();
+	LinkCount++;
+	//fprintf(stderr, "Linked: d(%i,%i) = %8.2f; orientation: %8s; order: %7s.\n", link.First, link.Second, link.Mean, (link.EqualOrientation ? "equal" : "opposite"), (link.ForwardOrder ? "forward" : "reverse"));
+	links.Append(link, groupId);
+}
+
+// Adds a batch of links as if AddLink was called for each of them in turn.
+void DataStore::AddLinks(LinkColumns &columns)
+{
+	for (int k = 0; k < columns.Count; k++)
+		if (columns.Groups[k] < 0 || columns.Groups[k] >= GroupCount)
+			throw exception();
+	for (int c = 0; c < columns.CommentCount; c++)
+		if (columns.CommentRows[c] < 0 || columns.CommentRows[c] >= columns.Count)
+			throw exception();
+	links.Append(columns);
+	LinkCount += max(columns.Count, 0);
+}
+
+// ends a batch of AddLink or AddLinks calls: orders the new links and rebuilds the indices
+void DataStore::FinalizeLinks()
+{
+	links.Finalize();
+}
+
+bool DataStore::ReadContigs(const string &fileName)
+{
+	MappedFastAReader reader;
+	FastASequence seq;
+	if (!reader.Open(fileName))
+		return false;
+	
+	contigs.reserve(ContigCount + reader.NumReads());
+	int read = 0;
+	while (reader.Read(seq))
+	{
+		Contig contig(seq);
+		AddContig(contig);
+		read++;
+	}
+	reader.Close();
+	return read != 0;
+}
+
+void DataStore::Sort()
+{
+	int n = links.Size();
+	for (int k = 0; k < n; k++)
+		if (links.First(k) > links.Second(k))
+			links.Flip(k);
+	links.Finalize();
+}
+
+void DataStore::Bundle(bool sortLinks, bool perGroup, bool joinAmbiguous, double distance)
+{
+	ProfileScope scope("Bundle links");
+	scope.Count("links", links.Size());
+	if (sortLinks)
+		Sort();
+
+	// links of one contig pair are a run of rows, the bundled links are added back through AddLink
+	LinkTable old;
+	old.Swap(links);
+	LinkCount = 0;
+	vector<ContigLink> vec;
+	int n = old.Size();
+	for (int start = 0, k = 0; start < n; start = k)
+	{
+		vec.clear();
+		for (k = start; k < n && old.First(k) == old.First(start) && old.Second(k) == old.Second(start); k++)
+			vec.push_back(old.Get(k));
+		bundleLinks(vec, perGroup, joinAmbiguous, distance);
+	}
+	links.Finalize();
+}
+
+void DataStore::Extract(const vector<int> &what, DataStore &store, vector<int> &transBack)
+{
+	ProfileScope scope("Extract component");
+	scope.Count("contigs", what.size());
+	vector<int> transGroup(GroupCount, -1);
+	int nWhat = what.size();
+	vector<int> ids(nWhat);
+	transBack.resize(nWhat, -1);
+	for (int i = 0; i < nWhat; i++)
+	{
+		int id = ids[i] = store.AddContig(contigs[what[i]]);
+		transBack[id] = what[i];
+	}
+	const LinkTable &links = Links();
+	visitLinksAmong(links, what, [&](int k, int a, int b) {
+		int groupId = links.GroupID(k);
+		if (transGroup[groupId] < 0)
+			transGroup[groupId] = store.AddGroup(this->GetGroup(groupId));
+		ContigLink link(ids[a], ids[b], links.Mean(k), links.Std(k), links.EqualOrientation(k), links.ForwardOrder(k), links.Weight(k));
+		link.Ambiguous = links.Ambiguous(k);
+		store.AddLink(transGroup[groupId], link);
+	});
+	store.FinalizeLinks();
+}
+
+int DataStore::Filter(LinkFilter &filter)
+{
+	ProfileScope scope("Filter links");
+	int n = links.Size(), nConditions = filter.conditions.size(), count = 0;
+	scope.Count("links", n);
+	for (int c = 0; c < nConditions; c++)
+		filter.conditions[c].Dropped = 0;
+	vector<char> keep(n, true);
+	for (int k = 0; k < n; k++)
+		for (int c = 0; c < nConditions; c++)
+			if (!filter.passes(filter.conditions[c], links, k))
+			{
+				filter.conditions[c].Dropped++;
+				keep[k] = false;
+				count++;
+				break;
+			}
+	if (count > 0)
+		links.Keep(keep);
+	links.Finalize();
+	LinkCount = links.Size();
+	return count;
+}
+
+int DataStore::RemoveAmbiguous()
+{
+	LinkFilter filter;
+	filter.RemoveAmbiguous();
+	return Filter(filter);
+}
+
+int DataStore::Erode(double weight)
+{
+	LinkFilter filter;
+	filter.Erode(weight);
+	return Filter(filter);
+}
+
+int DataStore::IsolateContigs(const vector<int> &ids)
+{
+    LinkFilter filter;
+    filter.IsolateContigs(ids);
+    return Filter(filter);
+}
+
+// drops the ambiguous links
+int LinkFilter::RemoveAmbiguous()
+{
+	return addCondition(AmbiguousCondition, 0, vector<int>());
+}
+
+// drops the links lighter than weight
+int LinkFilter::Erode(double weight)
+{
+	return addCondition(WeightCondition, weight, vector<int>());
+}
+
+// drops the links touching any of the contigs
+int LinkFilter::IsolateContigs(const vector<int> &ids)
+{
+	return addCondition(ContigCondition, 0, ids);
+}
+
+// drops the links outside of the groups
+int LinkFilter::SelectGroups(const vector<int> &ids)
+{
+	return addCondition(GroupCondition, 0, ids);
+}
+
+// the number of links the condition dropped when the filter was last applied
+int LinkFilter::Dropped(int condition) const
+{
+	return conditions[condition].Dropped;
+}
+
+int LinkFilter::addCondition(ConditionType type, double weight, const vector<int> &ids)
+{
+	Condition condition;
+	condition.Type = type;
+	condition.Weight = weight;
+	condition.Dropped = 0;
+	for (vector<int>::const_iterator id = ids.begin(); id != ids.end(); id++)
+		if (*id >= 0)
+		{
+			if (*id >= (int)condition.Members.size())
+				condition.Members.resize(*id + 1, false);
+			condition.Members[*id] = true;
+		}
+	conditions.push_back(condition);
+	return conditions.size() - 1;
+}
+
+bool LinkFilter::passes(const Condition &condition, const LinkTable &links, int k) const
+{
+	const vector<bool> &members = condition.Members;
+	int nMembers = members.size();
+	switch (condition.Type)
+	{
+	case AmbiguousCondition:
+		return !links.Ambiguous(k);
+	case WeightCondition:
+		return links.Weight(k) - condition.Weight > - Helpers::Eps;
+	case ContigCondition:
+	{
+		int a = links.First(k), b = links.Second(k);
+		return !((a < nMembers && members[a]) || (b < nMembers && members[b]));
+	}
+	case GroupCondition:
+	{
+		int group = links.GroupID(k);
+		return group < nMembers && members[group];
+	}
+	}
+	return true;
+}
+
+DataStoreView::DataStoreView()
+	: ContigCount(0), LinkCount(0), GroupCount(0), store(NULL), part(make_shared<Part>())
+{
+}
+
+DataStoreView::DataStoreView(const DataStore &store)
+	: ContigCount(store.ContigCount), LinkCount(store.Links().Size()), GroupCount(store.GroupCount), store(&store)
+{
+}
+
+DataStoreView::DataStoreView(const DataStoreView &parent, const vector<int> &what)
+	: ContigCount(what.size()), LinkCount(0), GroupCount(parent.GroupCount), store(parent.store)
+{
+	ProfileScope scope("Extract component");
+	scope.Count("contigs", what.size());
+	shared_ptr<Part> newPart = make_shared<Part>();
+	newPart->Ids.resize(ContigCount);
+	for (int i = 0; i < ContigCount; i++)
+		newPart->Ids[i] = parent.GetStoreID(what[i]);
+	const LinkTable &links = parent.Links();
+	visitLinksAmong(links, what, [&](int k, int a, int b) {
+		newPart->Links.Append(links, k, a, b);
+	});
+	newPart->Links.Finalize();
+	LinkCount = newPart->Links.Size();
+	part = newPart;
+}
+
+const Contig &DataStoreView::operator[] (int i) const
+{
+	return (*store)[GetStoreID(i)];
+}
+
+const LinkTable &DataStoreView::Links() const
+{
+	return part ? part->Links : store->Links();
+}
+
+const LinkGroup &DataStoreView::GetGroup(int id) const
+{
+	return store->GetGroup(id);
+}
+
+// the id of contig i in the underlying store
+int DataStoreView::GetStoreID(int i) const
+{
+	return part ? part->Ids[i] : i;
+}
+
+/*void DataStore::temp()
+{
+	vector<ContigLink> newStore;
+	LinkMap::iterator start = links.begin();
+	for (LinkMap::iterator it = links.begin(); it != links.end(); it++)
+	{
+		LinkMap::iterator maxIt = start;
+		while (it != links.end() && it->first == start->first)
+		{
+			if (it->second.Weight > maxIt->second.Weight)
+				maxIt = it;
+			it++;
+		}
+		newStore.push_back(maxIt->second);
+		start = it--;
+	}
+	links.clear();
+	for (vector<ContigLink>::iterator it = newStore.begin(); it != newStore.end(); it++)
+		links.insert(pair<pair<int,int>, ContigLink>(pair<int,int>(it->First, it->Second), *it));
+}*/
+
+void DataStore::bundleLinks(vector<ContigLink> &l, bool perGroup, bool joinAmbiguous, double distance)
+{
+	if (perGroup && joinAmbiguous)
+		sort(l.begin(), l.end(), linkComparerGroup);
+	else if (perGroup && !joinAmbiguous)
+		sort(l.begin(), l.end(), linkComparerAmbiguousGroup);
+	else if (!perGroup && joinAmbiguous)
+		sort(l.begin(), l.end(), linkComparer);
+	else
+		sort(l.begin(), l.end(), linkComparerAmbiguous);
+	int s = 0;
+	vector<ContigLink> sel;
+	while (selectGroup(l, perGroup, joinAmbiguous, s, sel))
+		while (sel.size() > 0)
+			performBundle(sel, distance);
+}
+
+void DataStore::performBundle(vector<ContigLink> &l, double distance)
+{
+	vector<ContigLink> r;
+	set<int> groupIds;
+	int n = l.size(), m = (n % 2 == 1 ? n / 2 : n / 2 - 1);
+	if (n == 0) return;
+	double p = 0, q = 0, w = 0;
+	bool ambiguous = false;
+	string comment;
+	for (int i = 0; i < n; i++)
+		if (abs(l[i].Mean - l[m].Mean) < distance * l[m].Std)
+		{
+			p += l[i].Mean / (l[i].Std * l[i].Std);
+			q += 1 / (l[i].Std * l[i].Std);
+			w += l[i].Weight;
+			ambiguous = ambiguous || l[i].Ambiguous;
+			if (l[i].Comment.length() > 0)
+			{
+				if (comment.length() == 0)
+					comment = l[i].Comment;
+				else
+					comment += "|" + l[i].Comment;
+			}
+			groupIds.insert(l[i].GetGroupID());
+		}
+		else r.push_back(l[i]);
+	ContigLink link(l[m].First, l[m].Second, p / q, 1 / sqrt(q), l[m].EqualOrientation, l[m].ForwardOrder, w, comment);
+	link.Ambiguous = ambiguous;
+	int groupId;
+	if (groupIds.size() > 1)
+	{
+		string name;
+		string description = "Group for bundle-links joining several groups.";
+		for (set<int>::iterator it = groupIds.begin(); it != groupIds.end(); it++)
+			name = name + "+" + Helpers::ItoStr(*it);
+		groupId = AddGroup(LinkGroup(name, description));
+	}
+	else
+		groupId = *groupIds.begin();
+	AddLink(groupId, link);
+	l.clear();
+	l.insert(l.begin(), r.begin(), r.end());
+}
+
+bool DataStore::linkComparerAmbiguous(const ContigLink &a, const ContigLink &b)
+{
+	if (!a.EqualOrientation && b.EqualOrientation)
+		return true;
+	if (a.EqualOrientation && !b.EqualOrientation)
+		return false;
+	if (!a.ForwardOrder && b.ForwardOrder)
+		return true;
+	if (a.ForwardOrder && !b.ForwardOrder)
+		return false;
+	if (!a.Ambiguous && b.Ambiguous)
+		return true;
+	if (a.Ambiguous && !b.Ambiguous)
+		return false;
+	return a.Mean < b.Mean;
+}
+
+bool DataStore::linkComparer(const ContigLink &a, const ContigLink &b)
+{
+	if (!a.EqualOrientation && b.EqualOrientation)
+		return true;
+	if (a.EqualOrientation && !b.EqualOrientation)
+		return false;
+	if (!a.ForwardOrder && b.ForwardOrder)
+		return true;
+	if (a.ForwardOrder && !b.ForwardOrder)
+		return false;
+	return a.Mean < b.Mean;
+}
+
+bool DataStore::linkComparerGroup(const ContigLink &a, const ContigLink &b)
+{
+	if (a.GetGroupID() < b.GetGroupID())
+		return true;
+	if (a.GetGroupID() > b.GetGroupID())
+		return false;
+	return linkComparer(a, b);
+}
+
+bool DataStore::linkComparerAmbiguousGroup(const ContigLink &a, const ContigLink &b)
+{
+	if (a.GetGroupID() < b.GetGroupID())
+		return true;
+	if (a.GetGroupID() > b.GetGroupID())
+		return false;
+	return linkComparerAmbiguous(a, b);
+}
+
+bool DataStore::selectGroup(vector<ContigLink> &l, bool perGroup, bool joinAmbiguous, int &s, vector<ContigLink> &selection)
+{
+	int i = s;
+	int n = l.size();
+	if (i >= n)
+		return false;
+	s++;
+	selection.clear();
+	selection.push_back(l[i]);
+	while (s < n && ((!perGroup || l[i].GetGroupID() == l[s].GetGroupID()) && l[i].EqualOrientation == l[s].EqualOrientation && l[i].ForwardOrder == l[s].ForwardOrder && (joinAmbiguous || l[i].Ambiguous == l[s].Ambiguous)))
+		selection.push_back(l[s++]);
+	return true;
+}
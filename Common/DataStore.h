@@ -1,145 +1,311 @@
-/*
- * Common : a collection of classes (re)used throughout the scaffolder implementation.
- * Copyright (C) 2011  Alexey Gritsenko
- * 
- * This program is free software: you can redistribute it and/or modify
- * it under the terms of the GNU General Public License as published by
- * the Free Software Foundation, either version 3 of the License, or
- * (at your option) any later version.
- *
- * This program is distributed in the hope that it will be useful,
- * but WITHOUT ANY WARRANTY; without even the implied warranty of
- * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- * GNU General Public License for more details.
- *
- * You should have received a copy of the GNU General Public License
- * along with this program.  If not, see http://www.gnu.org/licenses/.
- * 
- * 
- * 
- * Email: a.gritsenko@tudelft.nl
- * Mail: Delft University of Technology
- *       Faculty of Electrical Engineering, Mathematics, and Computer Science
- *       Department of Mediamatics
- *       P.O. Box 5031
- *       2600 GA, Delft, The Netherlands
- */
-
-
-#ifndef _DATASTORE_H
-#define _DATASTORE_H
-
-#include "Sequence.h"
-#include <vector>
-#include <string>
-#include <map>
-#include <set>
-
-using namespace std;
-
-class Contig
-{
-public:
-	Contig(const FastASequence &seq = FastASequence()) : Sequence(seq), id(0) {};
-
-public:
-	int GetID() const;
-
-public:
-	FastASequence Sequence;
-
-private:
-	int id;
-
-	friend class DataStore;
-};
-
-class ContigLink
-{
-public:
-	ContigLink(int first = -1, int second = -1, double mean = 0, double std = 0, bool equalOrientation = false, bool forwardOrder = false, double weight = 0, const string &comment = string());
-
-public:
-	bool operator< (const ContigLink &other);
-	int GetGroupID() const;
-
-public:
-	int First, Second;
-	double Mean, Std;
-	bool EqualOrientation;
-	bool ForwardOrder;
-	double Weight;
-	bool Ambiguous;
-	string Comment;
-
-private:
-	int groupId;
-
-	friend class DataStore;
-};
-
-class LinkGroup
-{
-public:
-	LinkGroup(const string &name, const string &description = (char *)"") : Name(name), Description(description), id(0) {};
-
-public:
-	int GetID() const;
-
-public:
-	string Name;
-	string Description;
-
-private:
-	int id;
-
-	friend class DataStore;
-};
-
-class DataStore
-{
-public:
-	DataStore() : ContigCount(0), LinkCount(0), GroupCount(0) {};
-	typedef multimap<pair<int,int>,ContigLink> LinkMap;
-	typedef pair<LinkMap::const_iterator, LinkMap::const_iterator> LinkRange;
-
-public:
-	const Contig &operator[] (int i) const;
-	const LinkRange operator() (int i, int j) const;
-	LinkMap::const_iterator Begin() const;
-	LinkMap::const_iterator End() const;
-	LinkMap::iterator Begin();
-	LinkMap::iterator End();
-	const LinkGroup &GetGroup(int id) const;
-        vector<FastASequence> GetContigs() const;
-	int AddContig(const Contig &contig);
-	int AddGroup(const LinkGroup &group);
-	LinkMap::const_iterator AddLink(int groupId, const ContigLink &link);
-	bool ReadContigs(const string &fileName);
-	void Sort();
-	void Bundle(bool sortLinks, bool perGroup, bool joinAmbiguous, double distance = 3);
-	void Extract(const vector<int> &what, DataStore &store, vector<int> &transBack);
-	int RemoveAmbiguous();
-	int Erode(double weight);
-        int IsolateContigs(const vector<int> &ids);
-
-private:
-	void bundleLinks(vector<ContigLink> &l, bool perGroup, bool joinAmbiguous, double distance);
-	void performBundle(vector<ContigLink> &l, double distance);
-	static bool linkComparer(const ContigLink &a, const ContigLink &b);
-	static bool linkComparerAmbiguous(const ContigLink &a, const ContigLink &b);
-	static bool linkComparerGroup(const ContigLink &a, const ContigLink &b);
-	static bool linkComparerAmbiguousGroup(const ContigLink &a, const ContigLink &b);
-	static bool selectGroup(vector<ContigLink> &l, bool perGroup, bool joinAmbiguous, int &s, vector<ContigLink> &selection);
-
-public:
-	int ContigCount;
-	int LinkCount;
-	int GroupCount;
-
-private:
-	vector<Contig> contigs;
-	vector<LinkGroup> groups;
-	LinkMap links;
-};
-#endif
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+
+#ifndef _DATASTORE_H
+#define _DATASTORE_H
+
+#include "Sequence.h"
+#include "PackedSequence.h"
+#include <vector>
+#include <string>
+#include <utility>
+#include <iterator>
+#include <memory>
+#include <cstddef>
+#include <stdint.h>
+
+using namespace std;
+
+class Contig
+{
+public:
+	Contig(const FastASequence &seq = FastASequence()) : Sequence(seq), id(0) {};
+	Contig(const PackedFastASequence &seq) : Sequence(seq), id(0) {};
+
+public:
+	int GetID() const;
+
+public:
+	PackedFastASequence Sequence;
+
+private:
+	int id;
+
+	friend class DataStore;
+};
+
+class ContigLink
+{
+public:
+	ContigLink(int first = -1, int second = -1, double mean = 0, double std = 0, bool equalOrientation = false, bool forwardOrder = false, double weight = 0, const string &comment = string());
+
+public:
+	bool operator< (const ContigLink &other);
+	int GetGroupID() const;
+
+public:
+	int First, Second;
+	double Mean, Std;
+	bool EqualOrientation;
+	bool ForwardOrder;
+	double Weight;
+	bool Ambiguous;
+	string Comment;
+
+private:
+	int groupId;
+
+	friend class DataStore;
+	friend class LinkTable;
+};
+
+class LinkGroup
+{
+public:
+	LinkGroup(const string &name, const string &description = (char *)"") : Name(name), Description(description), id(0) {};
+
+public:
+	int GetID() const;
+
+public:
+	string Name;
+	string Description;
+
+private:
+	int id;
+
+	friend class DataStore;
+};
+
+/*
+ * A batch of links given column by column, as a reader that already holds the
+ * columns can hand them over without going through ContigLink. Flags uses the
+ * LinkTable flag bits. Only the rows listed in CommentRows carry a comment; the
+ * comment strings are moved into the table.
+ */
+struct LinkColumns
+{
+	int Count;
+	const int32_t *Groups, *First, *Second;
+	const double *Mean, *Std, *Weight;
+	const uint8_t *Flags;
+	int CommentCount;
+	const int *CommentRows;
+	string *Comments;
+};
+
+/*
+ * The links of a DataStore live in a LinkTable: one flat column per field,
+ * ordered by the contig pair (first, second), links of equal pairs keeping
+ * the order they were added in. Next to the columns sit a row index (the
+ * links leaving contig i are the rows [OutBegin(i), OutEnd(i))) and a reverse
+ * adjacency (the rows entering contig j, ordered by first contig), so both
+ * directions of a neighbourhood are contiguous runs. Links are read through
+ * the column accessors by row; Get assembles a whole ContigLink.
+ *
+ * Append only pushes onto the columns, Finalize restores the order and the
+ * indices. A DataStore finalizes its table at the end of every operation that
+ * changes it; a batch of AddLink calls ends with FinalizeLinks, and Links()
+ * refuses a table with pending links, so readers never write to it.
+ */
+class LinkTable
+{
+public:
+	// bits of the flags column
+	enum { EqualOrientationFlag = 1, ForwardOrderFlag = 2, AmbiguousFlag = 4 };
+
+public:
+	LinkTable() : sorted(true), indexed(false), contigs(0) {};
+
+public:
+	int Size() const { return linkFirst.size(); };
+	int First(int k) const { return linkFirst[k]; };
+	int Second(int k) const { return linkSecond[k]; };
+	int GroupID(int k) const { return linkGroup[k]; };
+	double Mean(int k) const { return linkMean[k]; };
+	double Std(int k) const { return linkStd[k]; };
+	double Weight(int k) const { return linkWeight[k]; };
+	bool EqualOrientation(int k) const { return (linkFlags[k] & EqualOrientationFlag) != 0; };
+	bool ForwardOrder(int k) const { return (linkFlags[k] & ForwardOrderFlag) != 0; };
+	bool Ambiguous(int k) const { return (linkFlags[k] & AmbiguousFlag) != 0; };
+	const string &Comment(int k) const;
+	ContigLink Get(int k) const;
+	void Get(int k, ContigLink &link) const;
+	// the index accessors below are only valid on a finalized table
+	int OutBegin(int i) const { return i >= 0 && i < contigs ? outOffsets[i] : Size(); };
+	int OutEnd(int i) const { return i >= 0 && i < contigs ? outOffsets[i + 1] : Size(); };
+	const int *InBegin(int j) const { return j >= 0 && j < contigs ? inLinks.data() + inOffsets[j] : NULL; };
+	const int *InEnd(int j) const { return j >= 0 && j < contigs ? inLinks.data() + inOffsets[j + 1] : NULL; };
+	pair<int,int> Find(int i, int j) const;
+	bool IsFinalized() const { return sorted && indexed; };
+	void Reserve(int n);
+	void Append(const ContigLink &link, int groupId);
+	void Append(const LinkTable &source, int k, int first, int second);
+	void Append(LinkColumns &columns);
+	void Flip(int k);
+	int Keep(const vector<char> &keep);
+	void Clear();
+	void Swap(LinkTable &other);
+	void Finalize();
+
+private:
+	void appendKey(int first, int second);
+	void sortRows();
+	void buildIndex();
+
+private:
+	vector<int> linkFirst, linkSecond, linkGroup;
+	vector<double> linkMean, linkStd, linkWeight;
+	vector<unsigned char> linkFlags;
+	vector<int> linkComment;
+	vector<string> comments;
+	bool sorted, indexed;
+	int contigs;
+	vector<int> outOffsets, inOffsets, inLinks;
+};
+
+/*
+ * A LinkFilter gathers conditions on links so that DataStore::Filter can
+ * apply all of them in one pass over the link table and compact it once.
+ * Adding a condition returns its index. A dropped link is counted against the
+ * first condition it fails, so the counts are the ones the conditions would
+ * report when applied one after the other in the order they were added.
+ */
+class LinkFilter
+{
+public:
+	int RemoveAmbiguous();
+	int Erode(double weight);
+	int IsolateContigs(const vector<int> &ids);
+	int SelectGroups(const vector<int> &ids);
+	int Dropped(int condition) const;
+
+private:
+	enum ConditionType { AmbiguousCondition, WeightCondition, ContigCondition, GroupCondition };
+	struct Condition
+	{
+		ConditionType Type;
+		double Weight;
+		vector<bool> Members;
+		int Dropped;
+	};
+
+private:
+	int addCondition(ConditionType type, double weight, const vector<int> &ids);
+	bool passes(const Condition &condition, const LinkTable &links, int k) const;
+
+private:
+	vector<Condition> conditions;
+
+	friend class DataStore;
+};
+
+class DataStore
+{
+public:
+	DataStore() : ContigCount(0), LinkCount(0), GroupCount(0) {};
+
+public:
+	const Contig &operator[] (int i) const;
+	const LinkTable &Links() const;
+	const LinkGroup &GetGroup(int id) const;
+        vector<FastASequence> GetContigs() const;
+	int AddContig(const Contig &contig);
+	int AddGroup(const LinkGroup &group);
+	void AddLink(int groupId, const ContigLink &link);
+	void AddLinks(LinkColumns &columns);
+	void FinalizeLinks();
+	bool ReadContigs(const string &fileName);
+	void Sort();
+	void Bundle(bool sortLinks, bool perGroup, bool joinAmbiguous, double distance = 3);
+	void Extract(const vector<int> &what, DataStore &store, vector<int> &transBack);
+	int Filter(LinkFilter &filter);
+	int RemoveAmbiguous();
+	int Erode(double weight);
+        int IsolateContigs(const vector<int> &ids);
+
+private:
+	void bundleLinks(vector<ContigLink> &l, bool perGroup, bool joinAmbiguous, double distance);
+	void performBundle(vector<ContigLink> &l, double distance);
+	static bool linkComparer(const ContigLink &a, const ContigLink &b);
+	static bool linkComparerAmbiguous(const ContigLink &a, const ContigLink &b);
+	static bool linkComparerGroup(const ContigLink &a, const ContigLink &b);
+	static bool linkComparerAmbiguousGroup(const ContigLink &a, const ContigLink &b);
+	static bool selectGroup(vector<ContigLink> &l, bool perGroup, bool joinAmbiguous, int &s, vector<ContigLink> &selection);
+
+public:
+	int ContigCount;
+	int LinkCount;
+	int GroupCount;
+
+private:
+	vector<Contig> contigs;
+	vector<LinkGroup> groups;
+	LinkTable links;
+};
+
+/*
+ * A DataStoreView presents a store, or the part of it spanned by a set of
+ * contigs, through the read interface of DataStore. Contigs and groups are
+ * looked up in the underlying store instead of being copied. A part numbers
+ * its contigs 0..n-1 in the order they were given and keeps the links among
+ * them, renumbered, in a table shared by all copies of the view; a view of a
+ * whole store holds nothing but a pointer. Solvers can therefore take views
+ * by value. The store has to outlive its views and must not change while
+ * they are in use.
+ */
+class DataStoreView
+{
+public:
+	DataStoreView();
+	DataStoreView(const DataStore &store);
+	DataStoreView(const DataStoreView &parent, const vector<int> &what);
+
+public:
+	const Contig &operator[] (int i) const;
+	const LinkTable &Links() const;
+	const LinkGroup &GetGroup(int id) const;
+	int GetStoreID(int i) const;
+
+public:
+	int ContigCount;
+	int LinkCount;
+	int GroupCount;
+
+private:
+	struct Part
+	{
+		vector<int> Ids;
+		LinkTable Links;
+	};
+
+private:
+	const DataStore *store;
+	shared_ptr<const Part> part;
+};
+#endif
@@ -0,0 +1,130 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+/*
+ * On-disk layout of the binary DataStore format. The file starts with a header
+ * holding the offsets of all sections; every section is 8-byte aligned so that
+ * the file can be mapped and its tables used in place. Links are stored column
+ * by column in the order of the LinkTable, all text lives in a single string blob.
+ * Contig sequences are kept the way PackedSequence holds them: the two-bit words
+ * of all contigs in one section, their exception and mask runs in two more.
+ */
+
+#ifndef _DATASTOREFORMAT_H
+#define _DATASTOREFORMAT_H
+
+#include <stdint.h>
+
+enum DataStoreFileFormat
+{
+    TextDataStore,
+    BinaryDataStore
+};
+
+const char DataStoreMagic[8] = { 'G', 'R', 'A', 'S', 'S', 'D', 'S', '\0' };
+const uint32_t DataStoreVersion = 2;
+const uint32_t DataStoreByteOrder = 0x01020304;
+
+// bits of the link flags column
+const uint8_t LinkEqualOrientation = 1;
+const uint8_t LinkForwardOrder = 2;
+const uint8_t LinkAmbiguous = 4;
+
+struct DataStoreHeader
+{
+    char Magic[8];
+    uint32_t Version;
+    uint32_t ByteOrder;
+    int64_t ContigCount;
+    int64_t GroupCount;
+    int64_t LinkCount;
+    // file offsets of the sections
+    uint64_t ContigTable;
+    uint64_t GroupTable;
+    uint64_t LinkGroups;
+    uint64_t LinkFirst;
+    uint64_t LinkSecond;
+    uint64_t LinkMean;
+    uint64_t LinkStd;
+    uint64_t LinkWeight;
+    uint64_t LinkFlags;
+    uint64_t LinkComments;
+    uint64_t SequenceWords;
+    uint64_t SequenceWordCount;
+    uint64_t SequenceExceptions;
+    uint64_t SequenceExceptionCount;
+    uint64_t SequenceMasks;
+    uint64_t SequenceMaskCount;
+    uint64_t Strings;
+    uint64_t StringsSize;
+};
+
+// offset and length of a string inside the string blob
+struct DataStoreString
+{
+    uint64_t Offset;
+    uint64_t Length;
+};
+
+// first entry and number of entries of a run inside one of the sequence sections
+struct DataStoreRange
+{
+    uint64_t Start;
+    uint64_t Count;
+};
+
+struct DataStoreContigEntry
+{
+    uint64_t Length;
+    DataStoreRange Words;
+    DataStoreRange Exceptions;
+    DataStoreRange Masks;
+    DataStoreString Comment;
+};
+
+// a PackedException with explicit padding
+struct DataStoreException
+{
+    uint64_t Start;
+    uint32_t Length;
+    uint8_t Base;
+    uint8_t Padding[3];
+};
+
+struct DataStoreMask
+{
+    uint64_t Start;
+    uint64_t Length;
+};
+
+struct DataStoreGroupEntry
+{
+    DataStoreString Name;
+    DataStoreString Description;
+};
+
+#endif
@@ -1,191 +1,455 @@
-/*
- * Common : a collection of classes (re)used throughout the scaffolder implementation.
- * Copyright (C) 2011  Alexey Gritsenko
- * 
- * This program is free software: you can redistribute it and/or modify
- * it under the terms of the GNU General Public License as published by
- * the Free Software Foundation, either version 3 of the License, or
- * (at your option) any later version.
- *
- * This program is distributed in the hope that it will be useful,
- * but WITHOUT ANY WARRANTY; without even the implied warranty of
- * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- * GNU General Public License for more details.
- *
- * You should have received a copy of the GNU General Public License
- * along with this program.  If not, see http://www.gnu.org/licenses/.
- * 
- * 
- * 
- * Email: a.gritsenko@tudelft.nl
- * Mail: Delft University of Technology
- *       Faculty of Electrical Engineering, Mathematics, and Computer Science
- *       Department of Mediamatics
- *       P.O. Box 5031
- *       2600 GA, Delft, The Netherlands
- */
-
-
-#include "DataStoreReader.h"
-#include "Helpers.h"
-#include <sstream>
-
-#include <iostream>
-
-using namespace std;
-
-DataStoreReader::~DataStoreReader()
-{
-	if (in.is_open())
-		in.close();
-}
-
-bool DataStoreReader::Open(const string &fileName)
-{
-	if (in.is_open())
-		return false;
-	in.open(fileName.c_str(), ios::in);
-	return in.is_open();
-}
-
-bool DataStoreReader::Close()
-{
-	in.close();
-	return true;
-}
-
-bool DataStoreReader::Read(DataStore &store)
-{
-	int nContigs, nGroups, nLinks;
-	if (!in.is_open())
-		return false;
-	if (!readHeader(nContigs, nGroups, nLinks))
-		return false;
-	if (!readContigs(nContigs, store))
-		return false;
-	if (!readGroups(nGroups, store))
-		return false;
-	if (!readLinks(nLinks, store))
-		return false;
-	return true;
-}
-
-bool DataStoreReader::readHeader(int &nContigs, int &nGroups, int &nLinks)
-{
-	string line;
-	getline(in, line);
-	string contigsStr = Helpers::NextEntry(line);
-	string groupsStr = Helpers::NextEntry(line);
-	string linksStr = Helpers::NextEntry(line);
-	if (contigsStr.length() == 0 || groupsStr.length() == 0 || linksStr.length() == 0)
-		return false;
-	nContigs = Helpers::GetArgument<int>(contigsStr);
-	nGroups = Helpers::GetArgument<int>(groupsStr);
-	nLinks = Helpers::GetArgument<int>(linksStr);
-	if (nContigs <= 0 || nGroups <= 0 || nLinks < 0)
-		return false;
-	return true;
-}
-
-bool DataStoreReader::readContigs(int nContigs, DataStore &store)
-{
-	Contig contig;
-	int contigID;
-	for (int i = 0; i < nContigs; i++)
-	{
-		if (in.eof() || !readContig(contig, contigID))
-			return false;
-		if (store.AddContig(contig) != contigID)
-			return false;
-	}
-	return true;
-}
-
-bool DataStoreReader::readGroups(int nGroups, DataStore &store)
-{
-	LinkGroup group("");
-	int groupId;
-	for (int i = 0; i < nGroups; i++)
-	{
-		if (in.eof() || !readGroup(group, groupId))
-			return false;
-		if (store.AddGroup(group) != groupId)
-			return false;
-	}
-	return true;
-}
-
-bool DataStoreReader::readLinks(int nLinks, DataStore &store)
-{
-	int groupID;
-	ContigLink link;
-	for (int i = 0; i < nLinks; i++)
-	{
-		if (in.eof() || !readLink(groupID, link))
-			return false;
-		store.AddLink(groupID, link);
-	}
-	return true;
-}
-
-bool DataStoreReader::readContig(Contig &contig, int &id)
-{
-	string line, seq;
-	getline(in, line);
-	if (in.eof()) return false;
-	getline(in, seq);
-	string idStr = Helpers::NextEntry(line);
-	string commentStr = Helpers::NextEntry(line);
-	seq = Helpers::NextEntry(seq);
-	if (idStr.length() == 0 || commentStr.length() == 0 || seq.length() == 0)
-		return false;
-	id = Helpers::GetArgument<int>(idStr);
-	contig = Contig(FastASequence(seq, commentStr));
-	return true;
-}
-
-bool DataStoreReader::readGroup(LinkGroup &group, int &id)
-{
-	string line;
-	getline(in, line);
-	string idStr = Helpers::NextEntry(line);
-	string nameStr = Helpers::NextEntry(line);
-	string descriptionStr = Helpers::NextEntry(line);
-	if (idStr.length() == 0 || nameStr.length() == 0)
-		return false;
-	id = Helpers::GetArgument<int>(idStr);
-	group = LinkGroup(nameStr, descriptionStr);
-	return true;
-}
-
-bool DataStoreReader::readLink(int &groupID, ContigLink &link)
-{
-	string line;
-	getline(in, line);
-	string groupIdStr = Helpers::NextEntry(line);
-	string firstStr = Helpers::NextEntry(line);
-	string secondStr = Helpers::NextEntry(line);
-	string orientationStr = Helpers::NextEntry(line);
-	string orderStr = Helpers::NextEntry(line);
-	string meanStr = Helpers::NextEntry(line);
-	string stdStr = Helpers::NextEntry(line);
-	string ambiguousStr = Helpers::NextEntry(line);
-	string weightStr = Helpers::NextEntry(line);
-	string commentStr = Helpers::NextEntry(line);
-	if (firstStr.length() == 0 || secondStr.length() == 0 || orientationStr.length() == 0 || orderStr.length() == 0 || meanStr.length() == 0 || stdStr.length() == 0 || ambiguousStr.length() == 0 || weightStr.length() == 0)
-		return false;
-	groupID = Helpers::GetArgument<int>(groupIdStr);
-	int first = Helpers::GetArgument<int>(firstStr);
-	int second = Helpers::GetArgument<int>(secondStr);
-	bool equalOrientation = Helpers::GetArgument<int>(orientationStr) == 1;
-	bool forwardOrder = Helpers::GetArgument<int>(orderStr) == 1;
-	double mean = Helpers::GetArgument<double>(meanStr);
-	double std = Helpers::GetArgument<double>(stdStr);
-	bool ambiguous = Helpers::GetArgument<int>(ambiguousStr) == 1;
-	double weight = Helpers::GetArgument<double>(weightStr);
-	if (groupID < 0 || first < 0 || second < 0 || weight <= 0)
-		return false;
-	link = ContigLink(first, second, mean, std, equalOrientation, forwardOrder, weight, commentStr);
-	link.Ambiguous = ambiguous;
-	return true;
-}
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+
+#include "DataStoreReader.h"
+#include "Helpers.h"
+#include "Profiler.h"
+#include "TaskScheduler.h"
+#include <cstring>
+#include <cstdlib>
+#include <cctype>
+#include <climits>
+#include <algorithm>
+
+using namespace std;
+
+namespace
+{
+	// minimal amount of link data worth handing to a separate thread
+	const size_t MinChunkSize = 1 << 20;
+
+	// Splits a line into tab separated fields in place, mirroring Helpers::NextEntry.
+	class FieldReader
+	{
+	public:
+		FieldReader(const char *begin, const char *end) : pos(begin), end(end) {};
+
+		// returns an empty field once the line is exhausted
+		void Next(const char *&field, size_t &length)
+		{
+			field = pos;
+			while (pos < end && *pos != '\t')
+				pos++;
+			length = pos - field;
+			if (pos < end)
+				pos++;
+		}
+
+	private:
+		const char *pos;
+		const char *end;
+	};
+
+	// parses a leading integer like stringstream >> int does, without allocating
+	bool parseInt(const char *field, size_t length, int &value)
+	{
+		const char *end = field + length;
+		while (field < end && isspace(*field))
+			field++;
+		bool negative = field < end && *field == '-';
+		if (field < end && (*field == '-' || *field == '+'))
+			field++;
+		if (field == end || !isdigit(*field))
+			return false;
+		long long result = 0;
+		for (; field < end && isdigit(*field); field++)
+		{
+			result = result * 10 + (*field - '0');
+			if (result > 2147483648LL)
+				return false;
+		}
+		if (!negative && result > 2147483647LL)
+			return false;
+		value = negative ? -result : result;
+		return true;
+	}
+
+	// the field is copied to a stack buffer so that strtod never reads past the mapped line
+	bool parseDouble(const char *field, size_t length, double &value)
+	{
+		char buf[64];
+		if (length == 0 || length >= sizeof(buf))
+			return false;
+		memcpy(buf, field, length);
+		buf[length] = '\0';
+		char *end;
+		value = strtod(buf, &end);
+		return end != buf;
+	}
+}
+
+DataStoreReader::~DataStoreReader()
+{
+	Close();
+}
+
+bool DataStoreReader::Open(const string &fileName)
+{
+	if (file.IsOpen() || !file.Open(fileName))
+		return false;
+	// binary files are recognised by their magic number
+	if (file.Size() >= sizeof(DataStoreMagic) && memcmp(file.Data(), DataStoreMagic, sizeof(DataStoreMagic)) == 0)
+		format = BinaryDataStore;
+	else
+		format = TextDataStore;
+	position = 0;
+	return true;
+}
+
+bool DataStoreReader::Close()
+{
+	file.Close();
+	return true;
+}
+
+bool DataStoreReader::Read(DataStore &store)
+{
+	ProfileScope scope("Read store");
+	int nContigs, nGroups, nLinks;
+	if (!file.IsOpen())
+		return false;
+	if (format == BinaryDataStore)
+	{
+		if (!readBinary(store))
+			return false;
+	}
+	else
+	{
+		if (!readHeader(nContigs, nGroups, nLinks))
+			return false;
+		if (!readContigs(nContigs, store))
+			return false;
+		if (!readGroups(nGroups, store))
+			return false;
+		if (!readLinks(nLinks, store))
+			return false;
+	}
+	store.FinalizeLinks();
+	return true;
+}
+
+bool DataStoreReader::nextLine(const char *&line, const char *&end)
+{
+	if (position >= file.Size())
+		return false;
+	line = file.Data() + position;
+	end = (const char *)memchr(line, '\n', file.Size() - position);
+	if (end == NULL)
+		end = file.Data() + file.Size();
+	position = end - file.Data() + 1;
+	return true;
+}
+
+bool DataStoreReader::readHeader(int &nContigs, int &nGroups, int &nLinks)
+{
+	const char *line, *end;
+	if (!nextLine(line, end))
+		return false;
+	FieldReader fields(line, end);
+	const char *contigsStr, *groupsStr, *linksStr;
+	size_t contigsLen, groupsLen, linksLen;
+	fields.Next(contigsStr, contigsLen);
+	fields.Next(groupsStr, groupsLen);
+	fields.Next(linksStr, linksLen);
+	if (!parseInt(contigsStr, contigsLen, nContigs) || !parseInt(groupsStr, groupsLen, nGroups) || !parseInt(linksStr, linksLen, nLinks))
+		return false;
+	if (nContigs <= 0 || nGroups <= 0 || nLinks < 0)
+		return false;
+	return true;
+}
+
+bool DataStoreReader::readContigs(int nContigs, DataStore &store)
+{
+	Contig contig;
+	int contigID;
+	for (int i = 0; i < nContigs; i++)
+	{
+		if (!readContig(contig, contigID))
+			return false;
+		if (store.AddContig(contig) != contigID)
+			return false;
+	}
+	return true;
+}
+
+bool DataStoreReader::readGroups(int nGroups, DataStore &store)
+{
+	LinkGroup group("");
+	int groupId;
+	for (int i = 0; i < nGroups; i++)
+	{
+		if (!readGroup(group, groupId))
+			return false;
+		if (store.AddGroup(group) != groupId)
+			return false;
+	}
+	return true;
+}
+
+// The link section is cut at line boundaries into one part per thread. Every part is parsed
+// independently and the results are bulk loaded into the store in file order.
+bool DataStoreReader::readLinks(int nLinks, DataStore &store)
+{
+	const char *begin = file.Data() + min(position, file.Size());
+	const char *end = file.Data() + file.Size();
+	size_t size = end - begin;
+
+	int nThreads = threads > 0 ? threads : TaskScheduler::GetThreadCount();
+	nThreads = max(1, min(nThreads, (int)(size / MinChunkSize) + 1));
+	vector<const char *> bounds(nThreads + 1, end);
+	bounds[0] = begin;
+	for (int i = 1; i < nThreads; i++)
+	{
+		const char *pos = max(bounds[i - 1], begin + size / nThreads * i);
+		const char *eol = (const char *)memchr(pos, '\n', end - pos);
+		bounds[i] = eol == NULL ? end : eol + 1;
+	}
+
+	vector<LinkChunk> chunks(nThreads);
+	TaskScheduler::ParallelFor(0, nThreads, [&](int i) {
+		parseLinks(bounds[i], bounds[i + 1], nLinks, chunks[i]);
+	});
+
+	// only the first nLinks lines matter, a malformed line beyond them is ignored
+	int remaining = nLinks;
+	for (int i = 0; i < nThreads && remaining > 0; i++)
+	{
+		LinkChunk &chunk = chunks[i];
+		int n = min(remaining, (int)chunk.Groups.size());
+		if (n < remaining && chunk.Failed)
+			return false;
+		for (int k = 0; k < n; k++)
+			if (chunk.Groups[k] >= store.GroupCount)
+				return false;
+		LinkColumns columns;
+		columns.Count = n;
+		columns.Groups = chunk.Groups.data();
+		columns.First = chunk.First.data();
+		columns.Second = chunk.Second.data();
+		columns.Mean = chunk.Mean.data();
+		columns.Std = chunk.Std.data();
+		columns.Weight = chunk.Weight.data();
+		columns.Flags = chunk.Flags.data();
+		columns.CommentCount = lower_bound(chunk.CommentRows.begin(), chunk.CommentRows.end(), n) - chunk.CommentRows.begin();
+		columns.CommentRows = chunk.CommentRows.data();
+		columns.Comments = chunk.Comments.data();
+		store.AddLinks(columns);
+		remaining -= n;
+	}
+	return remaining == 0;
+}
+
+bool DataStoreReader::readContig(Contig &contig, int &id)
+{
+	const char *line, *lineEnd, *seq, *seqEnd;
+	if (!nextLine(line, lineEnd) || !nextLine(seq, seqEnd))
+		return false;
+	FieldReader fields(line, lineEnd), seqFields(seq, seqEnd);
+	const char *idStr, *commentStr;
+	size_t idLen, commentLen, seqLen;
+	fields.Next(idStr, idLen);
+	fields.Next(commentStr, commentLen);
+	seqFields.Next(seq, seqLen);
+	if (idLen == 0 || commentLen == 0 || seqLen == 0 || !parseInt(idStr, idLen, id))
+		return false;
+	contig = Contig(PackedFastASequence(PackedSequence(seq, seqLen), string(commentStr, commentLen)));
+	return true;
+}
+
+bool DataStoreReader::readGroup(LinkGroup &group, int &id)
+{
+	const char *line, *end;
+	if (!nextLine(line, end))
+		return false;
+	FieldReader fields(line, end);
+	const char *idStr, *nameStr, *descriptionStr;
+	size_t idLen, nameLen, descriptionLen;
+	fields.Next(idStr, idLen);
+	fields.Next(nameStr, nameLen);
+	fields.Next(descriptionStr, descriptionLen);
+	if (idLen == 0 || nameLen == 0 || !parseInt(idStr, idLen, id))
+		return false;
+	group = LinkGroup(string(nameStr, nameLen), string(descriptionStr, descriptionLen));
+	return true;
+}
+
+// parses whole lines of [begin, end) until maxLinks links are read or a line is malformed
+void DataStoreReader::parseLinks(const char *begin, const char *end, int maxLinks, LinkChunk &chunk)
+{
+	chunk.Failed = false;
+	while (begin < end && (int)chunk.Groups.size() < maxLinks)
+	{
+		const char *eol = (const char *)memchr(begin, '\n', end - begin);
+		if (eol == NULL)
+			eol = end;
+		if (!readLink(begin, eol, chunk))
+		{
+			chunk.Failed = true;
+			return;
+		}
+		begin = eol + 1;
+	}
+}
+
+// appends the link on the line as a new row of the chunk
+bool DataStoreReader::readLink(const char *line, const char *end, LinkChunk &chunk)
+{
+	FieldReader fields(line, end);
+	const char *str[10];
+	size_t len[10];
+	for (int i = 0; i < 10; i++)
+		fields.Next(str[i], len[i]);
+	int groupID, first, second, orientation, order, ambiguous;
+	double mean, std, weight;
+	if (!parseInt(str[0], len[0], groupID) || !parseInt(str[1], len[1], first) || !parseInt(str[2], len[2], second) ||
+		!parseInt(str[3], len[3], orientation) || !parseInt(str[4], len[4], order) || !parseDouble(str[5], len[5], mean) ||
+		!parseDouble(str[6], len[6], std) || !parseInt(str[7], len[7], ambiguous) || !parseDouble(str[8], len[8], weight))
+		return false;
+	if (groupID < 0 || first < 0 || second < 0 || weight <= 0)
+		return false;
+	if (len[9] > 0)
+	{
+		chunk.CommentRows.push_back(chunk.Groups.size());
+		chunk.Comments.push_back(string(str[9], len[9]));
+	}
+	chunk.Groups.push_back(groupID);
+	chunk.First.push_back(first);
+	chunk.Second.push_back(second);
+	chunk.Mean.push_back(mean);
+	chunk.Std.push_back(std);
+	chunk.Weight.push_back(weight);
+	chunk.Flags.push_back((orientation == 1 ? LinkTable::EqualOrientationFlag : 0) | (order == 1 ? LinkTable::ForwardOrderFlag : 0) | (ambiguous == 1 ? LinkTable::AmbiguousFlag : 0));
+	return true;
+}
+
+bool DataStoreReader::validSection(uint64_t offset, uint64_t count, size_t size) const
+{
+	return offset % 8 == 0 && offset <= file.Size() && count <= (file.Size() - offset) / size;
+}
+
+bool DataStoreReader::validRange(const DataStoreRange &range, uint64_t count)
+{
+	return range.Start <= count && range.Count <= count - range.Start;
+}
+
+bool DataStoreReader::readBinary(DataStore &store)
+{
+	const char *data = file.Data();
+	if (file.Size() < sizeof(DataStoreHeader))
+		return false;
+	const DataStoreHeader &header = *(const DataStoreHeader *)data;
+	if (header.Version != DataStoreVersion || header.ByteOrder != DataStoreByteOrder)
+		return false;
+	if (header.ContigCount <= 0 || header.GroupCount <= 0 || header.LinkCount < 0 || header.LinkCount > INT_MAX)
+		return false;
+	uint64_t nContigs = header.ContigCount, nGroups = header.GroupCount, nLinks = header.LinkCount;
+	if (!validSection(header.ContigTable, nContigs, sizeof(DataStoreContigEntry)) || !validSection(header.GroupTable, nGroups, sizeof(DataStoreGroupEntry)) ||
+		!validSection(header.LinkGroups, nLinks, sizeof(int32_t)) || !validSection(header.LinkFirst, nLinks, sizeof(int32_t)) || !validSection(header.LinkSecond, nLinks, sizeof(int32_t)) ||
+		!validSection(header.LinkMean, nLinks, sizeof(double)) || !validSection(header.LinkStd, nLinks, sizeof(double)) || !validSection(header.LinkWeight, nLinks, sizeof(double)) ||
+		!validSection(header.LinkFlags, nLinks, sizeof(uint8_t)) || !validSection(header.LinkComments, nLinks, sizeof(DataStoreString)) ||
+		!validSection(header.SequenceWords, header.SequenceWordCount, sizeof(uint64_t)) || !validSection(header.SequenceExceptions, header.SequenceExceptionCount, sizeof(DataStoreException)) ||
+		!validSection(header.SequenceMasks, header.SequenceMaskCount, sizeof(DataStoreMask)) || !validSection(header.Strings, header.StringsSize, 1))
+		return false;
+
+	// the packed words are taken over as they are, only the runs are unpacked into vectors
+	const uint64_t *words = (const uint64_t *)(data + header.SequenceWords);
+	const DataStoreException *exceptionRuns = (const DataStoreException *)(data + header.SequenceExceptions);
+	const DataStoreMask *maskRuns = (const DataStoreMask *)(data + header.SequenceMasks);
+	const char *strings = data + header.Strings;
+	const DataStoreContigEntry *contigs = (const DataStoreContigEntry *)(data + header.ContigTable);
+	vector<PackedException> exceptions;
+	vector<PackedMask> masks;
+	for (uint64_t i = 0; i < nContigs; i++)
+	{
+		const DataStoreContigEntry &entry = contigs[i];
+		const DataStoreString &comment = entry.Comment;
+		if (entry.Words.Count != (entry.Length + 31) / 32 || !validRange(entry.Words, header.SequenceWordCount) ||
+			!validRange(entry.Exceptions, header.SequenceExceptionCount) || !validRange(entry.Masks, header.SequenceMaskCount) ||
+			comment.Offset > header.StringsSize || comment.Length > header.StringsSize - comment.Offset)
+			return false;
+		exceptions.resize(entry.Exceptions.Count);
+		for (uint64_t j = 0; j < entry.Exceptions.Count; j++)
+		{
+			const DataStoreException &run = exceptionRuns[entry.Exceptions.Start + j];
+			exceptions[j].Start = run.Start;
+			exceptions[j].Length = run.Length;
+			exceptions[j].Base = run.Base;
+		}
+		masks.resize(entry.Masks.Count);
+		for (uint64_t j = 0; j < entry.Masks.Count; j++)
+		{
+			masks[j].Start = maskRuns[entry.Masks.Start + j].Start;
+			masks[j].Length = maskRuns[entry.Masks.Start + j].Length;
+		}
+		PackedSequence seq;
+		if (!seq.Assign(entry.Length, words + entry.Words.Start, exceptions, masks))
+			return false;
+		store.AddContig(Contig(PackedFastASequence(seq, string(strings + comment.Offset, comment.Length))));
+	}
+
+	const DataStoreGroupEntry *groups = (const DataStoreGroupEntry *)(data + header.GroupTable);
+	for (uint64_t i = 0; i < nGroups; i++)
+	{
+		const DataStoreString &name = groups[i].Name, &description = groups[i].Description;
+		if (name.Offset > header.StringsSize || name.Length > header.StringsSize - name.Offset || description.Offset > header.StringsSize || description.Length > header.StringsSize - description.Offset)
+			return false;
+		store.AddGroup(LinkGroup(string(strings + name.Offset, name.Length), string(strings + description.Offset, description.Length)));
+	}
+
+	// the link columns are validated in place and appended to the store in bulk
+	static_assert(LinkTable::EqualOrientationFlag == LinkEqualOrientation && LinkTable::ForwardOrderFlag == LinkForwardOrder && LinkTable::AmbiguousFlag == LinkAmbiguous, "link flag bits differ");
+	LinkColumns columns;
+	columns.Count = nLinks;
+	columns.Groups = (const int32_t *)(data + header.LinkGroups);
+	columns.First = (const int32_t *)(data + header.LinkFirst);
+	columns.Second = (const int32_t *)(data + header.LinkSecond);
+	columns.Mean = (const double *)(data + header.LinkMean);
+	columns.Std = (const double *)(data + header.LinkStd);
+	columns.Weight = (const double *)(data + header.LinkWeight);
+	columns.Flags = (const uint8_t *)(data + header.LinkFlags);
+	const DataStoreString *comments = (const DataStoreString *)(data + header.LinkComments);
+	vector<int> commentRows;
+	vector<string> commentTexts;
+	for (int k = 0; k < columns.Count; k++)
+	{
+		if (columns.Groups[k] < 0 || columns.Groups[k] >= store.GroupCount || columns.First[k] < 0 || columns.Second[k] < 0 || columns.Weight[k] <= 0)
+			return false;
+		if (comments[k].Offset > header.StringsSize || comments[k].Length > header.StringsSize - comments[k].Offset)
+			return false;
+		if (comments[k].Length > 0)
+		{
+			commentRows.push_back(k);
+			commentTexts.push_back(string(strings + comments[k].Offset, comments[k].Length));
+		}
+	}
+	columns.CommentCount = commentRows.size();
+	columns.CommentRows = commentRows.data();
+	columns.Comments = commentTexts.data();
+	store.AddLinks(columns);
+	return true;
+}
@@ -1,83 +1,282 @@
-/*
- * Common : a collection of classes (re)used throughout the scaffolder implementation.
- * Copyright (C) 2011  Alexey Gritsenko
- * 
- * This program is free software: you can redistribute it and/or modify
- * it under the terms of the GNU General Public License as published by
- * the Free Software Foundation, either version 3 of the License, or
- * (at your option) any later version.
- *
- * This program is distributed in the hope that it will be useful,
- * but WITHOUT ANY WARRANTY; without even the implied warranty of
- * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- * GNU General Public License for more details.
- *
- * You should have received a copy of the GNU General Public License
- * along with this program.  If not, see http://www.gnu.org/licenses/.
- * 
- * 
- * 
- * Email: a.gritsenko@tudelft.nl
- * Mail: Delft University of Technology
- *       Faculty of Electrical Engineering, Mathematics, and Computer Science
- *       Department of Mediamatics
- *       P.O. Box 5031
- *       2600 GA, Delft, The Netherlands
- */
-
-
-#include "DataStoreWriter.h"
-#include <cstdlib>
-#include <cstdio>
-
-DataStoreWriter::DataStoreWriter()
-{
-	out = NULL;
-}
-
-DataStoreWriter::~DataStoreWriter()
-{
-	if (out != NULL)
-	{
-		fclose(out);
-		out = NULL;
-	}
-}
-
-bool DataStoreWriter::Open(const string &fileName, const string &mode)
-{
-	if (out != NULL)
-		return false;
-	out = fopen(fileName.c_str(), mode.c_str());
-	return out != NULL;
-}
-
-bool DataStoreWriter::Close()
-{
-	fclose(out);
-	out = NULL;
-	return true;
-}
-
-bool DataStoreWriter::Write(const DataStore &store)
-{
-	if (out == NULL)
-		return false;
-	int nContigs = store.ContigCount;
-	int nGroups = store.GroupCount;
-	int nLink = store.LinkCount;
-	fprintf(out, "%i\t%i\t%i\n", nContigs, nGroups, nLink);
-	for (int i = 0; i < nContigs; i++)
-	{
-		fprintf(out, "%i\t%s\n", store[i].GetID(), store[i].Sequence.Comment.c_str());
-		fprintf(out, "%s\n", store[i].Sequence.Nucleotides.c_str());
-	}
-	for (int i = 0; i < nGroups; i++)
-	{
-		const LinkGroup &group = store.GetGroup(i);
-		fprintf(out, "%i\t%s\t%s\n", group.GetID(), group.Name.c_str(), group.Description.c_str());
-	}
-	for (DataStore::LinkMap::const_iterator it = store.Begin(); it != store.End(); it++)
-		fprintf(out, "%i\t%i\t%i\t%i\t%i\t%lf\t%lf\t%i\t%lf\t%s\n", it->second.GetGroupID(), it->first.first, it->first.second, (it->second.EqualOrientation ? 1 : 0), (it->second.ForwardOrder ? 1 : 0), it->second.Mean, it->second.Std, (it->second.Ambiguous ? 1 : 0), it->second.Weight, it->second.Comment.c_str());
-	return true;
-}
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+
+#include "DataStoreWriter.h"
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+
+DataStoreWriter::DataStoreWriter(DataStoreFileFormat format)
+{
+	out = NULL;
+	position = 0;
+	Format = format;
+}
+
+DataStoreWriter::~DataStoreWriter()
+{
+	if (out != NULL)
+	{
+		fclose(out);
+		out = NULL;
+	}
+}
+
+bool DataStoreWriter::Open(const string &fileName, const string &mode)
+{
+	if (out != NULL)
+		return false;
+	out = fopen(fileName.c_str(), mode.c_str());
+	return out != NULL;
+}
+
+bool DataStoreWriter::Close()
+{
+	fclose(out);
+	out = NULL;
+	return true;
+}
+
+bool DataStoreWriter::Write(const DataStore &store)
+{
+	if (out == NULL)
+		return false;
+	if (Format == BinaryDataStore)
+		return writeBinary(store);
+	return writeText(store);
+}
+
+bool DataStoreWriter::writeText(const DataStore &store)
+{
+	int nContigs = store.ContigCount;
+	int nGroups = store.GroupCount;
+	int nLink = store.LinkCount;
+	fprintf(out, "%i\t%i\t%i\n", nContigs, nGroups, nLink);
+	string nucleotides;
+	for (int i = 0; i < nContigs; i++)
+	{
+		store[i].Sequence.Nucleotides.Decode(nucleotides);
+		fprintf(out, "%i\t%s\n", store[i].GetID(), store[i].Sequence.Comment.c_str());
+		fprintf(out, "%s\n", nucleotides.c_str());
+	}
+	for (int i = 0; i < nGroups; i++)
+	{
+		const LinkGroup &group = store.GetGroup(i);
+		fprintf(out, "%i\t%s\t%s\n", group.GetID(), group.Name.c_str(), group.Description.c_str());
+	}
+	const LinkTable &links = store.Links();
+	for (int k = 0; k < links.Size(); k++)
+		fprintf(out, "%i\t%i\t%i\t%i\t%i\t%lf\t%lf\t%i\t%lf\t%s\n", links.GroupID(k), links.First(k), links.Second(k), (links.EqualOrientation(k) ? 1 : 0), (links.ForwardOrder(k) ? 1 : 0), links.Mean(k), links.Std(k), (links.Ambiguous(k) ? 1 : 0), links.Weight(k), links.Comment(k).c_str());
+	return true;
+}
+
+bool DataStoreWriter::writeBinary(const DataStore &store)
+{
+	DataStoreHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.Magic, DataStoreMagic, sizeof(header.Magic));
+	header.Version = DataStoreVersion;
+	header.ByteOrder = DataStoreByteOrder;
+	header.ContigCount = store.ContigCount;
+	header.GroupCount = store.GroupCount;
+	const LinkTable &links = store.Links();
+	size_t nLinks = links.Size();
+	header.LinkCount = nLinks;
+
+	// the header is rewritten once all section offsets are known
+	position = 0;
+	if (!write(&header, sizeof(header)) || !align())
+		return false;
+
+	// strings are laid out in the order: contig comments, group names and descriptions, link comments
+	uint64_t wordOffset = 0, exceptionOffset = 0, maskOffset = 0, stringOffset = 0;
+	vector<DataStoreContigEntry> contigs(store.ContigCount);
+	for (int i = 0; i < store.ContigCount; i++)
+	{
+		const PackedSequence &seq = store[i].Sequence.Nucleotides;
+		contigs[i].Length = seq.Length();
+		contigs[i].Words.Start = wordOffset;
+		contigs[i].Words.Count = seq.Words().size();
+		wordOffset += contigs[i].Words.Count;
+		contigs[i].Exceptions.Start = exceptionOffset;
+		contigs[i].Exceptions.Count = seq.Exceptions().size();
+		exceptionOffset += contigs[i].Exceptions.Count;
+		contigs[i].Masks.Start = maskOffset;
+		contigs[i].Masks.Count = seq.Masks().size();
+		maskOffset += contigs[i].Masks.Count;
+		contigs[i].Comment.Offset = stringOffset;
+		contigs[i].Comment.Length = store[i].Sequence.Comment.length();
+		stringOffset += contigs[i].Comment.Length;
+	}
+	if (!writeColumn(contigs, header.ContigTable))
+		return false;
+
+	vector<DataStoreGroupEntry> groups(store.GroupCount);
+	for (int i = 0; i < store.GroupCount; i++)
+	{
+		const LinkGroup &group = store.GetGroup(i);
+		groups[i].Name.Offset = stringOffset;
+		groups[i].Name.Length = group.Name.length();
+		stringOffset += groups[i].Name.Length;
+		groups[i].Description.Offset = stringOffset;
+		groups[i].Description.Length = group.Description.length();
+		stringOffset += groups[i].Description.Length;
+	}
+	if (!writeColumn(groups, header.GroupTable))
+		return false;
+
+	// link columns are written one at a time to bound the memory used
+	{
+		vector<int32_t> column(nLinks);
+		for (size_t i = 0; i < nLinks; i++)
+			column[i] = links.GroupID(i);
+		if (!writeColumn(column, header.LinkGroups))
+			return false;
+		for (size_t i = 0; i < nLinks; i++)
+			column[i] = links.First(i);
+		if (!writeColumn(column, header.LinkFirst))
+			return false;
+		for (size_t i = 0; i < nLinks; i++)
+			column[i] = links.Second(i);
+		if (!writeColumn(column, header.LinkSecond))
+			return false;
+	}
+	{
+		vector<double> column(nLinks);
+		for (size_t i = 0; i < nLinks; i++)
+			column[i] = links.Mean(i);
+		if (!writeColumn(column, header.LinkMean))
+			return false;
+		for (size_t i = 0; i < nLinks; i++)
+			column[i] = links.Std(i);
+		if (!writeColumn(column, header.LinkStd))
+			return false;
+		for (size_t i = 0; i < nLinks; i++)
+			column[i] = links.Weight(i);
+		if (!writeColumn(column, header.LinkWeight))
+			return false;
+	}
+	{
+		vector<uint8_t> column(nLinks);
+		for (size_t i = 0; i < nLinks; i++)
+			column[i] = (links.EqualOrientation(i) ? LinkEqualOrientation : 0) | (links.ForwardOrder(i) ? LinkForwardOrder : 0) | (links.Ambiguous(i) ? LinkAmbiguous : 0);
+		if (!writeColumn(column, header.LinkFlags))
+			return false;
+	}
+	{
+		vector<DataStoreString> column(nLinks);
+		for (size_t i = 0; i < nLinks; i++)
+		{
+			column[i].Offset = stringOffset;
+			column[i].Length = links.Comment(i).length();
+			stringOffset += column[i].Length;
+		}
+		if (!writeColumn(column, header.LinkComments))
+			return false;
+	}
+
+	// the packed sequences are written as they are held in memory
+	header.SequenceWords = position;
+	header.SequenceWordCount = wordOffset;
+	for (int i = 0; i < store.ContigCount; i++)
+	{
+		const vector<uint64_t> &words = store[i].Sequence.Nucleotides.Words();
+		if (!words.empty() && !write(&words[0], words.size() * sizeof(uint64_t)))
+			return false;
+	}
+	{
+		vector<DataStoreException> column(exceptionOffset);
+		for (int i = 0, k = 0; i < store.ContigCount; i++)
+		{
+			const vector<PackedException> &exceptions = store[i].Sequence.Nucleotides.Exceptions();
+			for (size_t j = 0; j < exceptions.size(); j++, k++)
+			{
+				column[k].Start = exceptions[j].Start;
+				column[k].Length = exceptions[j].Length;
+				column[k].Base = exceptions[j].Base;
+			}
+		}
+		if (!writeColumn(column, header.SequenceExceptions))
+			return false;
+		header.SequenceExceptionCount = exceptionOffset;
+	}
+	{
+		vector<DataStoreMask> column(maskOffset);
+		for (int i = 0, k = 0; i < store.ContigCount; i++)
+		{
+			const vector<PackedMask> &masks = store[i].Sequence.Nucleotides.Masks();
+			for (size_t j = 0; j < masks.size(); j++, k++)
+			{
+				column[k].Start = masks[j].Start;
+				column[k].Length = masks[j].Length;
+			}
+		}
+		if (!writeColumn(column, header.SequenceMasks))
+			return false;
+		header.SequenceMaskCount = maskOffset;
+	}
+
+	header.Strings = position;
+	header.StringsSize = stringOffset;
+	for (int i = 0; i < store.ContigCount; i++)
+		if (!write(store[i].Sequence.Comment.data(), store[i].Sequence.Comment.length()))
+			return false;
+	for (int i = 0; i < store.GroupCount; i++)
+	{
+		const LinkGroup &group = store.GetGroup(i);
+		if (!write(group.Name.data(), group.Name.length()) || !write(group.Description.data(), group.Description.length()))
+			return false;
+	}
+	for (size_t i = 0; i < nLinks; i++)
+		if (!write(links.Comment(i).data(), links.Comment(i).length()))
+			return false;
+
+	return fseek(out, 0, SEEK_SET) == 0 && fwrite(&header, sizeof(header), 1, out) == 1 && fseek(out, 0, SEEK_END) == 0;
+}
+
+bool DataStoreWriter::write(const void *data, size_t size)
+{
+	if (size > 0 && fwrite(data, 1, size, out) != size)
+		return false;
+	position += size;
+	return true;
+}
+
+// pads the output to the next multiple of 8 bytes
+bool DataStoreWriter::align()
+{
+	static const char padding[8] = { 0 };
+	return write(padding, (8 - position % 8) % 8);
+}
+
+template <class T> bool DataStoreWriter::writeColumn(const vector<T> &column, uint64_t &offset)
+{
+	offset = position;
+	return (column.empty() || write(&column[0], column.size() * sizeof(T))) && align();
+}
@@ -1,52 +1,66 @@
-/*
- * Common : a collection of classes (re)used throughout the scaffolder implementation.
- * Copyright (C) 2011  Alexey Gritsenko
- * 
- * This program is free software: you can redistribute it and/or modify
- * it under the terms of the GNU General Public License as published by
- * the Free Software Foundation, either version 3 of the License, or
- * (at your option) any later version.
- *
- * This program is distributed in the hope that it will be useful,
- * but WITHOUT ANY WARRANTY; without even the implied warranty of
- * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- * GNU General Public License for more details.
- *
- * You should have received a copy of the GNU General Public License
- * along with this program.  If not, see http://www.gnu.org/licenses/.
- * 
- * 
- * 
- * Email: a.gritsenko@tudelft.nl
- * Mail: Delft University of Technology
- *       Faculty of Electrical Engineering, Mathematics, and Computer Science
- *       Department of Mediamatics
- *       P.O. Box 5031
- *       2600 GA, Delft, The Netherlands
- */
-
-
-#ifndef _DATASTOREWRITER_H
-#define _DATASTOREWRITER_H
-
-#include <cstddef>
-#include <string>
-#include "DataStore.h"
-
-using namespace std;
-
-class DataStoreWriter
-{
-public:
-	DataStoreWriter();
-	virtual ~DataStoreWriter();
-
-public:
-	bool Open(const string &fileName, const string &mode = "wb");
-	bool Close();
-	bool Write(const DataStore &store);
-
-protected:
-	FILE *out;
-};
-#endif
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+
+#ifndef _DATASTOREWRITER_H
+#define _DATASTOREWRITER_H
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "DataStore.h"
+#include "DataStoreFormat.h"
+
+using namespace std;
+
+class DataStoreWriter
+{
+public:
+	DataStoreWriter(DataStoreFileFormat format = TextDataStore);
+	virtual ~DataStoreWriter();
+
+public:
+	bool Open(const string &fileName, const string &mode = "wb");
+	bool Close();
+	bool Write(const DataStore &store);
+
+private:
+	bool writeText(const DataStore &store);
+	bool writeBinary(const DataStore &store);
+	bool write(const void *data, size_t size);
+	bool align();
+	template <class T> bool writeColumn(const vector<T> &column, uint64_t &offset);
+
+public:
+	DataStoreFileFormat Format;
+
+protected:
+	FILE *out;
+	uint64_t position;
+};
+#endif
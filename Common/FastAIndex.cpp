@@ -0,0 +1,354 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+#include "FastAIndex.h"
+#include "MappedReader.h"
+#include "CompressedInput.h"
+#include "SequenceKernels.h"
+#include <cstring>
+#include <cstdlib>
+#include <cctype>
+#include <algorithm>
+#include <sys/stat.h>
+
+using namespace std;
+
+namespace
+{
+    bool isSpace(char c)
+    {
+        return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\v' || c == '\f';
+    }
+
+    // same as FastASequence::Name: the first word of the header
+    string firstWord(const string &comment)
+    {
+        size_t begin = 0;
+        while (begin < comment.length() && isSpace(comment[begin]))
+            begin++;
+        size_t end = begin;
+        while (end < comment.length() && !isSpace(comment[end]))
+            end++;
+        return comment.substr(begin, end - begin);
+    }
+
+    bool isNewer(const string &first, const string &second)
+    {
+        struct stat a, b;
+        if (stat(first.c_str(), &a) != 0 || stat(second.c_str(), &b) != 0)
+            return false;
+        return a.st_mtime >= b.st_mtime;
+    }
+}
+
+FastAIndex::FastAIndex()
+{
+    opened = false;
+    compressed = false;
+    commentsLoaded = false;
+    fasta = NULL;
+}
+
+FastAIndex::~FastAIndex()
+{
+    Close();
+}
+
+string FastAIndex::IndexFileName(const string &fastaFileName)
+{
+    return fastaFileName + ".fai";
+}
+
+bool FastAIndex::Open(const string &fastaFileName, bool writeIndex)
+{
+    if (opened)
+        return false;
+    fileName = fastaFileName;
+    compressed = CompressedInput::IsCompressed(fastaFileName);
+    string indexFileName = IndexFileName(fastaFileName);
+    if (!compressed && isNewer(indexFileName, fastaFileName) && Load(indexFileName))
+        return opened = true;
+    if (!Build(fastaFileName))
+        return false;
+    // the index may not be writable next to the FastA file, which is not an error
+    if (writeIndex && !compressed)
+        Save(indexFileName);
+    return opened = true;
+}
+
+bool FastAIndex::Close()
+{
+    if (fasta != NULL)
+        fclose(fasta);
+    fasta = NULL;
+    entries.clear();
+    ids.clear();
+    opened = false;
+    commentsLoaded = false;
+    return true;
+}
+
+bool FastAIndex::Build(const string &fastaFileName)
+{
+    MappedFile file;
+    if (!file.Open(fastaFileName))
+        return false;
+    fileName = fastaFileName;
+    compressed = CompressedInput::IsCompressed(fastaFileName);
+    entries.clear();
+
+    const char *data = file.Data();
+    size_t size = file.Size(), pos = 0;
+    // set once a line shorter than the first one was seen in the current sequence
+    bool shortLine = false, regular = true;
+    while (pos < size)
+    {
+        const char *newline = (const char *)memchr(data + pos, '\n', size - pos);
+        size_t end = newline != NULL ? newline - data : size;
+        size_t next = newline != NULL ? end + 1 : size;
+        size_t content = end;
+        while (content > pos && data[content - 1] == '\r')
+            content--;
+
+        if (data[pos] == '>')
+        {
+            if (!entries.empty() && !regular)
+                entries.back().LineBases = entries.back().LineWidth = 0;
+            FastAIndexEntry entry;
+            entry.Comment = string(data + pos + 1, content - pos - 1);
+            entry.Name = firstWord(entry.Comment);
+            entry.Length = 0;
+            entry.Offset = next;
+            entry.LineBases = entry.LineWidth = -1;
+            entries.push_back(entry);
+            shortLine = false;
+            regular = true;
+        }
+        else if (!entries.empty())
+        {
+            FastAIndexEntry &entry = entries.back();
+            int bases = content - pos;
+            if (entry.LineBases < 0)
+            {
+                entry.LineBases = bases;
+                entry.LineWidth = next - pos + (newline == NULL ? 1 : 0);
+            }
+            else if (bases > 0)
+            {
+                // all lines must have the same layout, only the last one may be shorter
+                bool sameWidth = newline == NULL || (int)(next - pos) == entry.LineWidth;
+                if (shortLine || bases > entry.LineBases || (bases == entry.LineBases && !sameWidth))
+                    regular = false;
+            }
+            if (bases < entry.LineBases)
+                shortLine = true;
+            entry.Length += bases;
+        }
+        pos = next;
+    }
+    if (!entries.empty() && !regular)
+        entries.back().LineBases = entries.back().LineWidth = 0;
+    for (size_t i = 0; i < entries.size(); i++)
+        if (entries[i].LineBases < 0 || compressed)
+            entries[i].LineBases = entries[i].LineWidth = 0;
+    createMap();
+    commentsLoaded = true;
+    return true;
+}
+
+bool FastAIndex::Load(const string &indexFileName)
+{
+    MappedFile file;
+    if (!file.Open(indexFileName))
+        return false;
+    entries.clear();
+    const char *data = file.Data();
+    size_t size = file.Size(), pos = 0;
+    while (pos < size)
+    {
+        const char *newline = (const char *)memchr(data + pos, '\n', size - pos);
+        size_t end = newline != NULL ? newline - data : size;
+        string line(data + pos, end - pos);
+        pos = end + 1;
+        if (line.empty())
+            continue;
+
+        size_t tab = line.find('\t');
+        if (tab == string::npos)
+            return false;
+        FastAIndexEntry entry;
+        entry.Name = line.substr(0, tab);
+        char *p = &line[tab + 1], *q;
+        entry.Length = strtoll(p, &q, 10);
+        entry.Offset = strtoll(q, &p, 10);
+        entry.LineBases = strtol(p, &q, 10);
+        entry.LineWidth = strtol(q, &p, 10);
+        if (p == q || entry.Length < 0 || entry.Offset < 0 || entry.LineBases < 0 || entry.LineWidth < entry.LineBases)
+            return false;
+        entries.push_back(entry);
+    }
+    createMap();
+    commentsLoaded = false;
+    return true;
+}
+
+bool FastAIndex::Save(const string &indexFileName) const
+{
+    // samtools cannot use an index of sequences with irregular lines, so it is not written
+    for (size_t i = 0; i < entries.size(); i++)
+        if (entries[i].LineBases <= 0 && entries[i].Length > 0)
+            return false;
+    FILE *out = fopen(indexFileName.c_str(), "w");
+    if (out == NULL)
+        return false;
+    bool result = true;
+    for (size_t i = 0; i < entries.size() && result; i++)
+        result = fprintf(out, "%s\t%lld\t%lld\t%i\t%i\n", entries[i].Name.c_str(), entries[i].Length, entries[i].Offset, entries[i].LineBases, entries[i].LineWidth) > 0;
+    return fclose(out) == 0 && result;
+}
+
+int FastAIndex::Find(const string &name) const
+{
+    unordered_map<string, int>::const_iterator it = ids.find(name);
+    return it == ids.end() ? -1 : it->second;
+}
+
+vector<string> FastAIndex::GetNames() const
+{
+    vector<string> names(entries.size());
+    for (size_t i = 0; i < entries.size(); i++)
+        names[i] = entries[i].Name;
+    return names;
+}
+
+vector<long long> FastAIndex::GetLengths() const
+{
+    vector<long long> lengths(entries.size());
+    for (size_t i = 0; i < entries.size(); i++)
+        lengths[i] = entries[i].Length;
+    return lengths;
+}
+
+bool FastAIndex::CanFetch(int id) const
+{
+    if (id < 0 || id >= Count() || compressed)
+        return false;
+    return entries[id].LineBases > 0 || entries[id].Length == 0;
+}
+
+bool FastAIndex::Fetch(int id, string &sequence)
+{
+    return id >= 0 && id < Count() && Fetch(id, 0, entries[id].Length, sequence);
+}
+
+bool FastAIndex::Fetch(int id, long long start, long long length, string &sequence)
+{
+    sequence.clear();
+    if (!CanFetch(id) || start < 0 || length < 0)
+        return false;
+    const FastAIndexEntry &entry = entries[id];
+    length = min(length, entry.Length - start);
+    if (length <= 0)
+        return start <= entry.Length;
+    if (!openFasta())
+        return false;
+
+    long long last = start + length - 1;
+    long long first = entry.Offset + (start / entry.LineBases) * entry.LineWidth + start % entry.LineBases;
+    long long end = entry.Offset + (last / entry.LineBases) * entry.LineWidth + last % entry.LineBases + 1;
+    string raw(end - first, '\0');
+    if (fseeko(fasta, first, SEEK_SET) != 0 || fread(&raw[0], 1, raw.size(), fasta) != raw.size())
+        return false;
+
+    sequence.reserve(length);
+    for (size_t i = 0; i < raw.size(); i++)
+        if (raw[i] != '\n' && raw[i] != '\r')
+            sequence.push_back(raw[i]);
+    SequenceKernels::ToUpper(sequence);
+    return (long long)sequence.length() == length;
+}
+
+bool FastAIndex::Fetch(int id, FastASequence &sequence)
+{
+    return GetComment(id, sequence.Comment) && Fetch(id, sequence.Nucleotides);
+}
+
+bool FastAIndex::GetComment(int id, string &comment)
+{
+    comment.clear();
+    if (id < 0 || id >= Count())
+        return false;
+    if (!commentsLoaded)
+        loadComments();
+    const FastAIndexEntry &entry = entries[id];
+    // a header is never empty unless the name is, so an empty comment means it was not found
+    if (entry.Comment.empty() && !entry.Name.empty())
+        return false;
+    comment = entry.Comment;
+    return true;
+}
+
+// An index loaded from a .fai file has no headers. They are collected for all
+// sequences at once from the mapped FastA file: the header of a sequence is
+// the line right before its first base.
+void FastAIndex::loadComments()
+{
+    commentsLoaded = true;
+    MappedFile file;
+    if (compressed || !file.Open(fileName))
+        return;
+    const char *data = file.Data();
+    long long size = file.Size();
+    for (int i = 0; i < Count(); i++)
+    {
+        FastAIndexEntry &entry = entries[i];
+        if (!entry.Comment.empty() || entry.Name.empty() || entry.Offset > size)
+            continue;
+        long long end = entry.Offset;
+        while (end > 0 && (data[end - 1] == '\n' || data[end - 1] == '\r'))
+            end--;
+        long long start = end;
+        while (start > 0 && data[start - 1] != '\n')
+            start--;
+        if (start < end && data[start] == '>')
+            entry.Comment.assign(data + start + 1, end - start - 1);
+    }
+}
+
+bool FastAIndex::openFasta()
+{
+    if (fasta == NULL)
+        fasta = fopen(fileName.c_str(), "rb");
+    return fasta != NULL;
+}
+
+void FastAIndex::createMap()
+{
+    ids.clear();
+    for (int i = 0; i < Count(); i++)
+        ids.insert(make_pair(entries[i].Name, i));
+}
@@ -0,0 +1,107 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+/*
+ * FastA index compatible with samtools faidx (.fai). The index holds the name,
+ * length and file layout of every sequence, so names and lengths are known
+ * without loading any sequence, and sequences or parts of them are fetched
+ * from the FastA file on demand. An up to date <file>.fai is loaded if present;
+ * otherwise the FastA file is scanned once and the index is written next to it.
+ */
+
+#ifndef _FASTAINDEX_H
+#define _FASTAINDEX_H
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include "Sequence.h"
+
+using namespace std;
+
+struct FastAIndexEntry
+{
+    string Name;
+    long long Length;
+    // file offset of the first base
+    long long Offset;
+    // bases per line and bytes per line including the line end, 0 if lines are irregular
+    int LineBases;
+    int LineWidth;
+    // full header line, read on first use when the index was loaded from a .fai file
+    string Comment;
+};
+
+class FastAIndex
+{
+public:
+    FastAIndex();
+    virtual ~FastAIndex();
+
+    // loads or builds the index of a FastA file, writing <file>.fai when it had to be built
+    bool Open(const string &fastaFileName, bool writeIndex = true);
+    bool Close();
+    bool IsOpen() const { return opened; }
+    // scans the FastA file; sequences of compressed or irregular files cannot be fetched
+    bool Build(const string &fastaFileName);
+    bool Load(const string &indexFileName);
+    bool Save(const string &indexFileName) const;
+
+    int Count() const { return entries.size(); }
+    const FastAIndexEntry &operator[](int id) const { return entries[id]; }
+    // id of the sequence with the given name, -1 if there is none
+    int Find(const string &name) const;
+    vector<string> GetNames() const;
+    vector<long long> GetLengths() const;
+    bool CanFetch(int id) const;
+    // sequences are returned in upper case, just like FastAReader does
+    bool Fetch(int id, string &sequence);
+    bool Fetch(int id, long long start, long long length, string &sequence);
+    bool Fetch(int id, FastASequence &sequence);
+    bool GetComment(int id, string &comment);
+
+    static string IndexFileName(const string &fastaFileName);
+
+private:
+    bool openFasta();
+    void createMap();
+    void loadComments();
+
+private:
+    bool opened;
+    bool compressed;
+    // set once the headers of all sequences are known
+    bool commentsLoaded;
+    string fileName;
+    FILE *fasta;
+    vector<FastAIndexEntry> entries;
+    unordered_map<string, int> ids;
+};
+
+#endif
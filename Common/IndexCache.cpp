@@ -0,0 +1,308 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+#include "IndexCache.h"
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <vector>
+#include <iostream>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+
+using namespace std;
+
+namespace
+{
+    const char *MarkerName = "/complete";
+    const char *IndexName = "/index";
+    const uint64_t Prime1 = 0x9e3779b185ebca87ULL;
+    const uint64_t Prime2 = 0xc2b2ae3d27d4eb4fULL;
+
+    inline uint64_t rotate(uint64_t x, int r)
+    {
+        return (x << r) | (x >> (64 - r));
+    }
+
+    inline uint64_t mix(uint64_t h, uint64_t word)
+    {
+        return rotate(h ^ (word * Prime2), 31) * Prime1;
+    }
+
+    uint64_t finalize(uint64_t h)
+    {
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        return h ^ (h >> 33);
+    }
+
+    uint64_t hashString(const string &str)
+    {
+        uint64_t h = Prime1;
+        for (size_t i = 0; i < str.length(); i++)
+            h = mix(h, (unsigned char)str[i]);
+        return finalize(h ^ str.length());
+    }
+
+    bool lock(int fd, int operation)
+    {
+        int result;
+        while ((result = flock(fd, operation)) != 0 && errno == EINTR);
+        return result == 0;
+    }
+
+    bool exists(const string &fileName)
+    {
+        struct stat s;
+        return stat(fileName.c_str(), &s) == 0;
+    }
+
+    struct CacheEntry
+    {
+        string Name;
+        time_t LastUse;
+        long long Size;
+
+        bool operator< (const CacheEntry &other) const
+        {
+            return LastUse < other.LastUse;
+        }
+    };
+}
+
+IndexLease::IndexLease()
+    : lockDescriptor(-1)
+{
+}
+
+IndexLease::~IndexLease()
+{
+    Release();
+}
+
+void IndexLease::Release()
+{
+    if (lockDescriptor >= 0)
+        close(lockDescriptor);
+    lockDescriptor = -1;
+    Prefix.clear();
+}
+
+bool IndexLease::IsValid() const
+{
+    return lockDescriptor >= 0;
+}
+
+IndexCache::IndexCache(const string &path, long long sizeLimit)
+    : path(path), sizeLimit(sizeLimit)
+{
+}
+
+bool IndexCache::Acquire(const string &referenceFile, const string &signature, const function<bool (const string &)> &build, IndexLease &lease)
+{
+    lease.Release();
+    if (mkdir(path.c_str(), 0700) != 0 && errno != EEXIST)
+    {
+        cerr << "[-] Unable to create index cache " << path << " (" << strerror(errno) << ")." << endl;
+        return false;
+    }
+    uint64_t contentHash;
+    if (!HashFile(referenceFile, contentHash))
+        return false;
+
+    char key[40];
+    sprintf(key, "%016llx-%016llx", (unsigned long long)contentHash, (unsigned long long)hashString(signature));
+    string entry = path + "/" + key, marker = entry + MarkerName;
+    int fd = open((entry + ".lock").c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+    if (fd < 0)
+    {
+        cerr << "[-] Unable to lock index cache entry " << entry << " (" << strerror(errno) << ")." << endl;
+        return false;
+    }
+
+    bool built = false;
+    while (true)
+    {
+        if (!lock(fd, LOCK_SH))
+        {
+            close(fd);
+            return false;
+        }
+        if (exists(marker))
+            break;
+
+        // nobody else may read or build the entry while it is (re)built
+        if (!lock(fd, LOCK_EX))
+        {
+            close(fd);
+            return false;
+        }
+        if (!exists(marker))
+        {
+            removeEntry(entry);
+            int markerFd = -1;
+            if (mkdir(entry.c_str(), 0700) != 0 || !build(entry + IndexName) || (markerFd = open(marker.c_str(), O_WRONLY | O_CREAT, 0600)) < 0)
+            {
+                removeEntry(entry);
+                close(fd);
+                return false;
+            }
+            close(markerFd);
+            built = true;
+        }
+        // converting back to a shared lock is not atomic, so the marker is checked again
+    }
+
+    // the marker's modification time orders entries for eviction
+    utimes(marker.c_str(), NULL);
+    lease.Prefix = entry + IndexName;
+    lease.lockDescriptor = fd;
+    if (built && sizeLimit > 0)
+        evict(key);
+    return true;
+}
+
+bool IndexCache::HashFile(const string &fileName, uint64_t &hash)
+{
+    FILE *file = fopen(fileName.c_str(), "rb");
+    if (!file)
+        return false;
+    vector<char> buffer(1 << 20);
+    uint64_t h = Prime2, total = 0;
+    size_t count;
+    while ((count = fread(&buffer[0], 1, buffer.size(), file)) > 0)
+    {
+        size_t words = count / sizeof(uint64_t);
+        for (size_t i = 0; i < words; i++)
+        {
+            uint64_t word;
+            memcpy(&word, &buffer[i * sizeof(uint64_t)], sizeof(word));
+            h = mix(h, word);
+        }
+        // only the final chunk can end in a partial word
+        for (size_t i = words * sizeof(uint64_t); i < count; i++)
+            h = mix(h, (unsigned char)buffer[i]);
+        total += count;
+    }
+    bool success = !ferror(file);
+    fclose(file);
+    hash = finalize(h ^ total);
+    return success;
+}
+
+// Removes least recently used entries nobody holds until the cache fits its limit.
+void IndexCache::evict(const string &keep)
+{
+    int fd = open((path + "/.lock").c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+    if (fd < 0)
+        return;
+    if (!lock(fd, LOCK_EX))
+    {
+        close(fd);
+        return;
+    }
+
+    vector<CacheEntry> entries;
+    long long total = 0;
+    DIR *dir = opendir(path.c_str());
+    if (dir)
+    {
+        struct dirent *item;
+        while ((item = readdir(dir)))
+        {
+            struct stat s;
+            string name = item->d_name, entry = path + "/" + name;
+            if (name[0] == '.' || stat(entry.c_str(), &s) != 0 || !S_ISDIR(s.st_mode))
+                continue;
+            CacheEntry cacheEntry;
+            cacheEntry.Name = name;
+            cacheEntry.LastUse = (stat((entry + MarkerName).c_str(), &s) == 0 ? s.st_mtime : 0);
+            cacheEntry.Size = entrySize(entry);
+            total += cacheEntry.Size;
+            entries.push_back(cacheEntry);
+        }
+        closedir(dir);
+    }
+
+    sort(entries.begin(), entries.end());
+    for (size_t i = 0; i < entries.size() && total > sizeLimit; i++)
+    {
+        if (entries[i].Name == keep)
+            continue;
+        string entry = path + "/" + entries[i].Name;
+        // lock files are never removed, another process may already have this one open
+        int entryFd = open((entry + ".lock").c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+        if (entryFd < 0)
+            continue;
+        if (flock(entryFd, LOCK_EX | LOCK_NB) == 0)
+        {
+            removeEntry(entry);
+            total -= entries[i].Size;
+        }
+        close(entryFd);
+    }
+    close(fd);
+}
+
+long long IndexCache::entrySize(const string &entry)
+{
+    long long size = 0;
+    DIR *dir = opendir(entry.c_str());
+    if (!dir)
+        return 0;
+    struct dirent *item;
+    while ((item = readdir(dir)))
+    {
+        struct stat s;
+        if (stat((entry + "/" + item->d_name).c_str(), &s) == 0 && S_ISREG(s.st_mode))
+            size += s.st_size;
+    }
+    closedir(dir);
+    return size;
+}
+
+void IndexCache::removeEntry(const string &entry)
+{
+    DIR *dir = opendir(entry.c_str());
+    if (!dir)
+        return;
+    struct dirent *item;
+    while ((item = readdir(dir)))
+    {
+        if (strcmp(item->d_name, ".") != 0 && strcmp(item->d_name, "..") != 0)
+            unlink((entry + "/" + item->d_name).c_str());
+    }
+    closedir(dir);
+    rmdir(entry.c_str());
+}
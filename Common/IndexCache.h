@@ -0,0 +1,94 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+/*
+ * Persistent cache of aligner indices. An entry is keyed by a hash of the
+ * reference file contents and of the indexing command, so the same contigs are
+ * indexed once and then reused by both mates, every library and every tool run
+ * against them. Entries are guarded by flock: builders hold an exclusive lock,
+ * users a shared one for as long as they need the files, and least recently
+ * used entries that nobody holds are evicted once the cache outgrows its limit.
+ * The cache directory and its entries are created private to the user.
+ */
+
+#ifndef _INDEXCACHE_H
+#define _INDEXCACHE_H
+
+#include <functional>
+#include <stdint.h>
+#include <string>
+
+using namespace std;
+
+// Shared lock on a cached index, the files under Prefix stay valid while it is held.
+class IndexLease
+{
+public:
+    IndexLease();
+    ~IndexLease();
+
+public:
+    void Release();
+    bool IsValid() const;
+
+public:
+    string Prefix;
+
+private:
+    friend class IndexCache;
+    IndexLease(const IndexLease &);
+    IndexLease &operator=(const IndexLease &);
+
+private:
+    int lockDescriptor;
+};
+
+class IndexCache
+{
+public:
+    // sizeLimit in bytes, <= 0 never evicts
+    IndexCache(const string &path, long long sizeLimit);
+
+public:
+    // Leases the index of referenceFile made by the command described by signature,
+    // running build(prefix) first if it is not cached yet.
+    bool Acquire(const string &referenceFile, const string &signature, const function<bool (const string &)> &build, IndexLease &lease);
+
+public:
+    static bool HashFile(const string &fileName, uint64_t &hash);
+
+private:
+    void evict(const string &keep);
+    static long long entrySize(const string &entry);
+    static void removeEntry(const string &entry);
+
+private:
+    string path;
+    long long sizeLimit;
+};
+
+#endif
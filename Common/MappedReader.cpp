@@ -0,0 +1,402 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+#include "MappedReader.h"
+#include "CompressedInput.h"
+#include "SequenceKernels.h"
+#include <cstdlib>
+#include <cstring>
+#include <cctype>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+using namespace std;
+
+MappedFile::MappedFile()
+{
+    opened = false;
+    owned = false;
+    data = NULL;
+    size = 0;
+}
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+bool MappedFile::Open(const string &filename)
+{
+    if (opened)
+        return false;
+    if (CompressedInput::IsCompressed(filename))
+        return opened = load(filename);
+
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0)
+    {
+        ::close(fd);
+        return false;
+    }
+
+    size = st.st_size;
+    data = NULL;
+    if (size > 0)
+    {
+        void *map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map == MAP_FAILED)
+        {
+            ::close(fd);
+            return false;
+        }
+        madvise(map, size, MADV_SEQUENTIAL);
+        data = (const char *)map;
+    }
+    // the mapping stays valid after the descriptor is closed
+    ::close(fd);
+    return opened = true;
+}
+
+bool MappedFile::Close()
+{
+    if (!opened)
+        return false;
+    if (owned)
+        free((void *)data);
+    else if (data != NULL)
+        munmap((void *)data, size);
+    owned = false;
+    data = NULL;
+    size = 0;
+    opened = false;
+    return true;
+}
+
+bool MappedFile::load(const string &filename)
+{
+    CompressedInput input;
+    if (!input.Open(filename))
+        return false;
+
+    size_t capacity = 1 << 22;
+    char *buffer = (char *)malloc(capacity);
+    size_t length = 0;
+    while (buffer != NULL)
+    {
+        if (length == capacity)
+        {
+            char *grown = (char *)realloc(buffer, capacity *= 2);
+            if (grown == NULL)
+                break;
+            buffer = grown;
+        }
+        size_t n = input.Read(buffer + length, capacity - length);
+        if (n == 0)
+            break;
+        length += n;
+    }
+    if (buffer == NULL || input.Failed() || length == capacity)
+    {
+        free(buffer);
+        return false;
+    }
+    input.Close();
+
+    data = buffer;
+    size = length;
+    owned = true;
+    return true;
+}
+
+MappedReader::MappedReader()
+{
+    data = NULL;
+    size = 0;
+    current = 0;
+}
+
+MappedReader::~MappedReader()
+{
+    Close();
+}
+
+bool MappedReader::Open(const string &filename)
+{
+    if (!file.Open(filename))
+        return false;
+    data = file.Data();
+    size = file.Size();
+    current = 0;
+    if (!index())
+    {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+bool MappedReader::Close()
+{
+    if (!file.Close())
+        return false;
+    data = NULL;
+    size = 0;
+    current = 0;
+    vector<MappedRecord>().swap(records);
+    return true;
+}
+
+string MappedReader::GetComment(long long i) const
+{
+    return string(records[i].Comment, records[i].CommentLength);
+}
+
+void MappedReader::GetSequence(long long i, string &seq) const
+{
+    const MappedRecord &record = records[i];
+    if (record.SingleLine)
+    {
+        seq.assign(record.Data, record.Length);
+        SequenceKernels::ToUpper(seq);
+    }
+    else
+        copyBlock(record.Data, record.DataLength, true, seq);
+}
+
+bool MappedReader::Read(string &seq, string &comment)
+{
+    if (current >= records.size())
+        return false;
+    comment.assign(records[current].Comment, records[current].CommentLength);
+    GetSequence(current++, seq);
+    return true;
+}
+
+bool MappedReader::Read(FastASequence &seq)
+{
+    return Read(seq.Nucleotides, seq.Comment);
+}
+
+long long MappedReader::Read(vector<FastASequence> &sequences)
+{
+    sequences.resize(records.size());
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        sequences[i].Comment.assign(records[i].Comment, records[i].CommentLength);
+        GetSequence(i, sequences[i].Nucleotides);
+    }
+    current = records.size();
+    return sequences.size();
+}
+
+size_t MappedReader::lineEnd(size_t pos) const
+{
+    const char *eol = (const char *)memchr(data + pos, '\n', size - pos);
+    return eol == NULL ? size : eol - data;
+}
+
+size_t MappedReader::trimmedLength(size_t begin, size_t end) const
+{
+    while (end > begin && isspace(data[end - 1]))
+        --end;
+    return end - begin;
+}
+
+// Concatenates the lines of a raw block, dropping trailing whitespace on every line.
+void MappedReader::copyBlock(const char *block, size_t blockLength, bool upper, string &out)
+{
+    out.resize(blockLength);
+    size_t written = 0;
+    const char *end = block + blockLength;
+    while (block < end)
+    {
+        const char *eol = (const char *)memchr(block, '\n', end - block);
+        if (eol == NULL)
+            eol = end;
+        const char *last = eol;
+        while (last > block && isspace(last[-1]))
+            --last;
+        memcpy(&out[written], block, last - block);
+        written += last - block;
+        block = eol + 1;
+    }
+    out.resize(written);
+    if (upper)
+        SequenceKernels::ToUpper(out);
+}
+
+bool MappedFastAReader::index()
+{
+    size_t pos = 0;
+    while (pos < size)
+    {
+        size_t eol = lineEnd(pos);
+        // skip blank lines between records
+        if (trimmedLength(pos, eol) == 0)
+        {
+            pos = eol + 1;
+            continue;
+        }
+        if (data[pos] != '>')
+            return false;
+
+        MappedRecord record;
+        record.Comment = data + pos + 1;
+        record.CommentLength = eol - pos - 1;
+        if (record.CommentLength > 0 && record.Comment[record.CommentLength - 1] == '\r')
+            --record.CommentLength;
+        record.Quality = NULL;
+        record.QualityLength = 0;
+
+        size_t begin = eol < size ? eol + 1 : size;
+        size_t length = 0;
+        bool single = true;
+        for (pos = begin; pos < size && data[pos] != '>'; pos = eol + 1)
+        {
+            eol = lineEnd(pos);
+            size_t len = trimmedLength(pos, eol);
+            if (len > 0)
+            {
+                if (pos != begin)
+                    single = false;
+                length += len;
+            }
+        }
+        if (pos > size)
+            pos = size;
+
+        record.Data = data + begin;
+        record.DataLength = pos - begin;
+        record.Length = length;
+        record.SingleLine = single;
+        records.push_back(record);
+    }
+    return true;
+}
+
+bool MappedFastQReader::Read(string &seq, string &comment, string &quality)
+{
+    if (current >= records.size())
+        return false;
+    GetQuality(current, quality);
+    return MappedReader::Read(seq, comment);
+}
+
+bool MappedFastQReader::Read(FastQSequence &seq)
+{
+    return Read(seq.Nucleotides, seq.Comment, seq.Quality);
+}
+
+long long MappedFastQReader::Read(vector<FastQSequence> &sequences)
+{
+    sequences.resize(records.size());
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        sequences[i].Comment.assign(records[i].Comment, records[i].CommentLength);
+        GetSequence(i, sequences[i].Nucleotides);
+        GetQuality(i, sequences[i].Quality);
+    }
+    current = records.size();
+    return sequences.size();
+}
+
+void MappedFastQReader::GetQuality(long long i, string &quality) const
+{
+    copyBlock(records[i].Quality, records[i].QualityLength, false, quality);
+}
+
+bool MappedFastQReader::index()
+{
+    size_t pos = 0;
+    while (pos < size)
+    {
+        size_t eol = lineEnd(pos);
+        if (trimmedLength(pos, eol) == 0)
+        {
+            pos = eol + 1;
+            continue;
+        }
+        if (data[pos] != '@')
+            return false;
+
+        MappedRecord record;
+        record.Comment = data + pos + 1;
+        record.CommentLength = eol - pos - 1;
+        if (record.CommentLength > 0 && record.Comment[record.CommentLength - 1] == '\r')
+            --record.CommentLength;
+
+        size_t begin = eol < size ? eol + 1 : size;
+        size_t length = 0;
+        bool single = true;
+        for (pos = begin; pos < size && data[pos] != '+'; pos = eol + 1)
+        {
+            eol = lineEnd(pos);
+            size_t len = trimmedLength(pos, eol);
+            if (len > 0)
+            {
+                if (pos != begin)
+                    single = false;
+                length += len;
+            }
+        }
+        if (pos > size)
+            pos = size;
+        record.Data = data + begin;
+        record.DataLength = pos - begin;
+        record.Length = length;
+        record.SingleLine = single;
+
+        // quality scores follow the '+' line and may be wrapped just like the sequence
+        record.Quality = data + pos;
+        record.QualityLength = 0;
+        if (pos < size)
+        {
+            pos = lineEnd(pos) + 1;
+            size_t qualityBegin = pos < size ? pos : size;
+            size_t qualityLength = 0;
+            do
+            {
+                if (pos >= size)
+                    break;
+                eol = lineEnd(pos);
+                qualityLength += trimmedLength(pos, eol);
+                pos = eol + 1;
+            } while (qualityLength < length);
+            if (pos > size)
+                pos = size;
+            record.Quality = data + qualityBegin;
+            record.QualityLength = pos - qualityBegin;
+        }
+        records.push_back(record);
+    }
+    return true;
+}
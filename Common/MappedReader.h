@@ -0,0 +1,148 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+/*
+ * Memory-mapped FastA/FastQ readers. The input file is mapped into memory and
+ * indexed in a single pass; records are then served as views into the mapping,
+ * so lines of arbitrary length are supported and nothing is copied until a
+ * sequence is explicitly requested. Compressed input cannot be mapped and is
+ * decompressed into memory instead.
+ */
+
+#ifndef _MAPPEDREADER_H
+#define _MAPPEDREADER_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "Sequence.h"
+
+using namespace std;
+
+// Read-only contents of a whole file: mapped, or decompressed into memory for compressed input.
+class MappedFile
+{
+public:
+    MappedFile();
+    virtual ~MappedFile();
+
+    bool Open(const string &filename);
+    bool Close();
+    bool IsOpen() const { return opened; }
+    const char *Data() const { return data; }
+    size_t Size() const { return size; }
+
+private:
+    bool load(const string &filename);
+
+private:
+    bool opened;
+    // data was decompressed into an allocated buffer instead of being mapped
+    bool owned;
+    const char *data;
+    size_t size;
+};
+
+// View of a single record inside the mapped file.
+struct MappedRecord
+{
+    // header line without the leading '>' / '@' and the line terminator
+    const char *Comment;
+    size_t CommentLength;
+    // raw sequence block, possibly spanning several lines
+    const char *Data;
+    size_t DataLength;
+    // raw quality block (FastQ only)
+    const char *Quality;
+    size_t QualityLength;
+    // number of nucleotides in the record
+    size_t Length;
+    // whole sequence is stored on one line, i.e. Data[0 .. Length) is the sequence itself
+    bool SingleLine;
+};
+
+class MappedReader
+{
+public:
+    MappedReader();
+    virtual ~MappedReader();
+
+    bool Open(const string &filename);
+    bool Close();
+    bool IsOpen() const { return file.IsOpen(); }
+    void Rewind() { current = 0; }
+
+    long long NumReads() const { return records.size(); }
+    const MappedRecord &operator[](long long i) const { return records[i]; }
+    string GetComment(long long i) const;
+    void GetSequence(long long i, string &seq) const;
+
+    bool Read(string &seq, string &comment);
+    bool Read(FastASequence &seq);
+    long long Read(vector<FastASequence> &sequences);
+
+protected:
+    virtual bool index() = 0;
+    size_t lineEnd(size_t pos) const;
+    size_t trimmedLength(size_t begin, size_t end) const;
+    static void copyBlock(const char *block, size_t blockLength, bool upper, string &out);
+
+protected:
+    MappedFile file;
+    const char *data;
+    size_t size;
+    vector<MappedRecord> records;
+    size_t current;
+};
+
+class MappedFastAReader: public MappedReader
+{
+public:
+    MappedFastAReader() : MappedReader() {}
+    virtual ~MappedFastAReader() {}
+
+protected:
+    bool index();
+};
+
+class MappedFastQReader: public MappedReader
+{
+public:
+    MappedFastQReader() : MappedReader() {}
+    virtual ~MappedFastQReader() {}
+
+    using MappedReader::Read;
+    bool Read(string &seq, string &comment, string &quality);
+    bool Read(FastQSequence &seq);
+    long long Read(vector<FastQSequence> &sequences);
+    void GetQuality(long long i, string &quality) const;
+
+protected:
+    bool index();
+};
+
+#endif
@@ -28,20 +28,59 @@
 
 #include "MummerCoordReader.h"
 #include "Globals.h"
-#include <sstream>
 #include <cstring>
-
-#include <iostream>
+#include <cstdlib>
 
 using namespace std;
 
+namespace
+{
+    // parses the next whitespace separated number in place, like stringstream >> does
+    bool nextInt(char *&pos, int &value)
+    {
+        char *end;
+        long result = strtol(pos, &end, 10);
+        if (end == pos)
+            return false;
+        value = result;
+        pos = end;
+        return true;
+    }
+
+    bool nextDouble(char *&pos, double &value)
+    {
+        char *end;
+        value = strtod(pos, &end);
+        if (end == pos)
+            return false;
+        pos = end;
+        return true;
+    }
+
+    // returns the tab separated field starting at pos and moves past it
+    void nextField(char *&pos, const char *&field, size_t &length)
+    {
+        field = pos;
+        while (*pos != '\0' && *pos != '\t')
+            pos++;
+        length = pos - field;
+        if (*pos == '\t')
+            pos++;
+    }
+}
+
 MummerCoordReader::MummerCoordReader(const vector<FastASequence> &references, const vector<FastASequence> &scaffolds)
+    : referenceIds(getNames(references)), scaffoldIds(getNames(scaffolds))
+{
+    fin = NULL;
+    line = new char[MaxLine];
+}
+
+MummerCoordReader::MummerCoordReader(const vector<string> &referenceNames, const vector<string> &scaffoldNames)
+    : referenceIds(referenceNames), scaffoldIds(scaffoldNames)
 {
     fin = NULL;
     line = new char[MaxLine];
-    numCoords = -1;
-    createMap(referenceIds, references);
-    createMap(scaffoldIds, scaffolds);
 }
 
 MummerCoordReader::~MummerCoordReader()
@@ -57,6 +96,7 @@ bool MummerCoordReader::Open(const string &fileName, const string &mode)
     fin = fopen(fileName.c_str(), mode.c_str());
     if (fin == NULL)
         return false;
+    setvbuf(fin, NULL, _IOFBF, 1 << 20);
     return true;
 }
 
@@ -66,7 +106,6 @@ bool MummerCoordReader::Close()
     {
         fclose(fin);
         fin = NULL;
-        numCoords = -1;
         return true;
     }
     return false;
@@ -83,26 +122,29 @@ bool MummerCoordReader::Read(MummerCoord &coord)
         return false;
     
     int len = strlen(line);
-    if (len <= 1)
+    while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r'))
+        line[--len] = '\0';
+    if (len == 0)
         return false;
-    line[--len] = '\0';
     
-    int t;
-    stringstream ss(line);
-    ss >> coord.ReferencePosition >> t >> coord.QueryPosition >> t >> coord.ReferenceAlignmentLength >> coord.QueryAlignmentLength >> coord.Identity;
+    // [S1] [E1] [S2] [E2] [LEN 1] [LEN 2] [% IDY] [FRM] [FRM] [REF] [QUERY]
+    int t, referenceFrame, queryFrame;
+    char *pos = line;
+    if (!nextInt(pos, coord.ReferencePosition) || !nextInt(pos, t) || !nextInt(pos, coord.QueryPosition) || !nextInt(pos, t) ||
+        !nextInt(pos, coord.ReferenceAlignmentLength) || !nextInt(pos, coord.QueryAlignmentLength) || !nextDouble(pos, coord.Identity) ||
+        !nextInt(pos, referenceFrame) || !nextInt(pos, queryFrame))
+        return false;
     coord.Identity /= 100;
-    ss >> t;
-    coord.IsReferenceReverse = t < 0;
-    ss >> t;
-    coord.IsQueryReverse = t < 0;
-    
-    string tStr, referenceName, queryName;
-    getline(ss, tStr, '\t');
-    getline(ss, referenceName, '\t');
-    getline(ss, queryName, '\t');
+    coord.IsReferenceReverse = referenceFrame < 0;
+    coord.IsQueryReverse = queryFrame < 0;
     
-    auto it = referenceIds.find(referenceName); coord.ReferenceID = (it == referenceIds.end() ? -1 : it->second);
-    it = scaffoldIds.find(queryName); coord.QueryID = (it == scaffoldIds.end() ? -1 : it->second);
+    const char *referenceName, *queryName;
+    size_t referenceLength, queryLength;
+    nextField(pos, referenceName, referenceLength);
+    nextField(pos, referenceName, referenceLength);
+    nextField(pos, queryName, queryLength);
+    coord.ReferenceID = referenceIds.Find(referenceName, referenceLength);
+    coord.QueryID = scaffoldIds.Find(queryName, queryLength);
     
     // Lets use SamTools convention, no need to reverse coordinates
     if (coord.IsReferenceReverse)
@@ -119,34 +161,19 @@ bool MummerCoordReader::Read(MummerCoord &coord)
 
 long long MummerCoordReader::Read(vector<MummerCoord> &coords)
 {
-    coords.resize(NumCoords());
-    for (unsigned i = 0; i < coords.size(); ++i)
-        Read(coords[i]);
+    coords.clear();
+    MummerCoord coord;
+    while (Read(coord))
+        coords.push_back(coord);
 
     return coords.size();
 }
 
-long long MummerCoordReader::NumCoords()
-{
-    if (!IsOpen())
-        return 0;
-    long long index = ftell(fin);
-    
-    if (numCoords >= 0)
-        return numCoords;
-
-    fseek(fin, 0, SEEK_SET);
-    long long num = 0;
-    while (fgets(line, MaxLine, fin) != NULL)
-        ++num;
-    
-    fseek(fin, index, SEEK_SET);
-    return numCoords = num;
-}
-
-void MummerCoordReader::createMap(map<string, int> &store, const vector<FastASequence> &seq)
+vector<string> MummerCoordReader::getNames(const vector<FastASequence> &seq)
 {
     int nSeq = seq.size();
+    vector<string> names(nSeq);
     for (int i = 0; i < nSeq; i++)
-        store[seq[i].Name()] = i;
+        names[i] = seq[i].Name();
+    return names;
 }
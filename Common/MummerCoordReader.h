@@ -38,19 +38,22 @@
 
 #include <vector>
 #include <cstddef>
-#include <cstddef>
 #include <cstdio>
 #include <string>
-#include <map>
 #include "MummerCoord.h"
+#include "NameIndex.h"
 #include "Sequence.h"
 
 using namespace std;
 
+// Single pass reader for show-coords -T -d -H output. Records are parsed in place
+// and names are resolved through hashed indices, so Read(MummerCoord &) can be
+// used to stream alignments straight into their consumer.
 class MummerCoordReader
 {
 public:
     MummerCoordReader(const vector<FastASequence> &references, const vector<FastASequence> &scaffolds);
+    MummerCoordReader(const vector<string> &referenceNames, const vector<string> &scaffoldNames);
     ~MummerCoordReader();
     
 public:
@@ -59,19 +62,17 @@ public:
     bool IsOpen() const;
     bool Read(MummerCoord &coord);
     long long Read(vector<MummerCoord> &coords);
-    long long NumCoords();
     
 private:
     FILE *fin;
     char *line;
-    long long numCoords;
     
 private:
-    map<string, int> referenceIds;
-    map<string, int> scaffoldIds;
+    NameIndex referenceIds;
+    NameIndex scaffoldIds;
     
 private:
-    void createMap(map<string, int> &store, const vector<FastASequence> &seq);
+    static vector<string> getNames(const vector<FastASequence> &seq);
 };
 
 #endif	/* _MUMMERCOORDREADER_H */
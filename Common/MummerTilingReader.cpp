@@ -29,18 +29,61 @@
 #include "MummerTilingReader.h"
 #include "Globals.h"
 #include <cstring>
-#include <sstream>
+#include <cstdlib>
+#include <cctype>
 
 using namespace std;
 
+namespace
+{
+    // parses the next whitespace separated number in place, like stringstream >> does
+    bool nextInt(char *&pos, int &value)
+    {
+        char *end;
+        long result = strtol(pos, &end, 10);
+        if (end == pos)
+            return false;
+        value = result;
+        pos = end;
+        return true;
+    }
+
+    bool nextDouble(char *&pos, double &value)
+    {
+        char *end;
+        value = strtod(pos, &end);
+        if (end == pos)
+            return false;
+        pos = end;
+        return true;
+    }
+
+    // returns the tab separated field starting at pos and moves past it
+    void nextField(char *&pos, const char *&field, size_t &length)
+    {
+        field = pos;
+        while (*pos != '\0' && *pos != '\t')
+            pos++;
+        length = pos - field;
+        if (*pos == '\t')
+            pos++;
+    }
+}
+
 MummerTilingReader::MummerTilingReader(const vector<FastASequence> &references, const vector<FastASequence> &scaffolds)
+    : referenceIds(getNames(references)), scaffoldIds(getNames(scaffolds))
+{
+    fin = NULL;
+    line = new char[MaxLine];
+    referenceID = -1;
+}
+
+MummerTilingReader::MummerTilingReader(const vector<string> &referenceNames, const vector<string> &scaffoldNames)
+    : referenceIds(referenceNames), scaffoldIds(scaffoldNames)
 {
     fin = NULL;
     line = new char[MaxLine];
-    numCoords = -1;
     referenceID = -1;
-    createMap(referenceIds, references);
-    createMap(scaffoldIds, scaffolds);
 }
 
 MummerTilingReader::~MummerTilingReader()
@@ -56,6 +99,7 @@ bool MummerTilingReader::Open(const string &fileName, const string &mode)
     fin = fopen(fileName.c_str(), mode.c_str());
     if (fin == NULL)
         return false;
+    setvbuf(fin, NULL, _IOFBF, 1 << 20);
     return true;
 }
 
@@ -65,7 +109,6 @@ bool MummerTilingReader::Close()
     {
         fclose(fin);
         fin = NULL;
-        numCoords = -1;
         referenceID = -1;
         return true;
     }
@@ -79,46 +122,53 @@ bool MummerTilingReader::IsOpen() const
 
 bool MummerTilingReader::Read(MummerTiling &tiling)
 {
+    int len;
     do
     {
         if (fgets(line, MaxLine, fin) == NULL)
             return false;
 
-        int len = strlen(line);
-        if (len <= 1)
+        len = strlen(line);
+        while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r'))
+            line[--len] = '\0';
+        if (len == 0)
             return false;
-        line[--len] = '\0';
 
+        // >reference length bases
         if (line[0] == '>')
         {
-            stringstream tmpStream(line + 1);
-            string newReference;
-            tmpStream >> newReference;
-            auto it = referenceIds.find(newReference);
-            referenceID = (it == referenceIds.end() ? -1 : it->second);
+            const char *name = line + 1;
+            while (*name != '\0' && isspace(*name))
+                name++;
+            const char *end = name;
+            while (*end != '\0' && !isspace(*end))
+                end++;
+            referenceID = referenceIds.Find(name, end - name);
         }
-    } while (line != NULL && line[0] == '>');
+    } while (line[0] == '>');
     
     // Columns are, start in ref, end in ref
     // distance to next contig, length of this contig, alignment
     // coverage, identity, orientation, and ID respectively.
     
     int t, endPosition;
-    stringstream ss(line);
+    char *pos = line;
     tiling.ReferenceID = referenceID;
-    ss >> tiling.ReferencePosition >> endPosition >> t >> tiling.QueryLength >> tiling.Coverage >> tiling.Identity;
+    if (!nextInt(pos, tiling.ReferencePosition) || !nextInt(pos, endPosition) || !nextInt(pos, t) || !nextInt(pos, tiling.QueryLength) ||
+        !nextDouble(pos, tiling.Coverage) || !nextDouble(pos, tiling.Identity))
+        return false;
     tiling.ReferenceLength = endPosition - tiling.ReferencePosition + 1;
     tiling.Coverage /= 100;
     tiling.Identity /= 100;
     
-    string tStr, orientationString, queryName;
-    getline(ss, tStr, '\t');
-    getline(ss, orientationString, '\t');
-    getline(ss, queryName, '\t');
+    const char *orientation, *queryName;
+    size_t orientationLength, queryLength;
+    nextField(pos, orientation, orientationLength);
+    nextField(pos, orientation, orientationLength);
+    nextField(pos, queryName, queryLength);
     
-    tiling.IsReverse = orientationString == "-";
-    //cout << "Orientation: <" << orientationString << "> length = " << tiling.ReferenceLength << endl;
-    auto it = scaffoldIds.find(queryName); tiling.QueryID = (it == scaffoldIds.end() ? -1 : it->second);
+    tiling.IsReverse = orientationLength == 1 && orientation[0] == '-';
+    tiling.QueryID = scaffoldIds.Find(queryName, queryLength);
     
     // Turning to 0-based
     tiling.ReferencePosition--;
@@ -128,35 +178,19 @@ bool MummerTilingReader::Read(MummerTiling &tiling)
 
 long long MummerTilingReader::Read(vector<MummerTiling> &tilings)
 {
-    tilings.resize(NumTilings());
-    for (unsigned i = 0; i < tilings.size(); ++i)
-        Read(tilings[i]);
+    tilings.clear();
+    MummerTiling tiling;
+    while (Read(tiling))
+        tilings.push_back(tiling);
 
     return tilings.size();
 }
 
-long long MummerTilingReader::NumTilings()
-{
-    if (!IsOpen())
-        return 0;
-    long long index = ftell(fin);
-    
-    if (numCoords >= 0)
-        return numCoords;
-
-    fseek(fin, 0, SEEK_SET);
-    long long num = 0;
-    while (fgets(line, MaxLine, fin) != NULL)
-        if (line[0] != '>')
-            ++num;
-    
-    fseek(fin, index, SEEK_SET);
-    return numCoords = num;
-}
-
-void MummerTilingReader::createMap(map<string, int> &store, const vector<FastASequence> &seq)
+vector<string> MummerTilingReader::getNames(const vector<FastASequence> &seq)
 {
     int nSeq = seq.size();
+    vector<string> names(nSeq);
     for (int i = 0; i < nSeq; i++)
-        store[seq[i].Name()] = i;
-}
\ No newline at end of file
+        names[i] = seq[i].Name();
+    return names;
+}
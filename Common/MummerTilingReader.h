@@ -33,16 +33,18 @@
 #include <cstddef>
 #include <cstdio>
 #include <string>
-#include <map>
 #include "MummerTiling.h"
+#include "NameIndex.h"
 #include "Sequence.h"
 
 using namespace std;
 
+// Single pass reader for show-tiling output, see MummerCoordReader.
 class MummerTilingReader
 {
 public:
     MummerTilingReader(const vector<FastASequence> &references, const vector<FastASequence> &scaffolds);
+    MummerTilingReader(const vector<string> &referenceNames, const vector<string> &scaffoldNames);
     ~MummerTilingReader();
     
 public:
@@ -51,20 +53,18 @@ public:
     bool IsOpen() const;
     bool Read(MummerTiling &tiling);
     long long Read(vector<MummerTiling> &tilings);
-    long long NumTilings();
     
 private:
     FILE *fin;
     char *line;
-    long long numCoords;
     int referenceID;
     
 private:
-    map<string, int> referenceIds;
-    map<string, int> scaffoldIds;
+    NameIndex referenceIds;
+    NameIndex scaffoldIds;
     
 private:
-    void createMap(map<string, int> &store, const vector<FastASequence> &seq);
+    static vector<string> getNames(const vector<FastASequence> &seq);
 };
 
 #endif
@@ -0,0 +1,143 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+#include "NameIndex.h"
+#include <cstring>
+
+using namespace std;
+
+NameIndex::NameIndex()
+    : used(0)
+{
+}
+
+NameIndex::NameIndex(const vector<string> &names)
+    : used(0)
+{
+    Assign(names);
+}
+
+void NameIndex::Assign(const vector<string> &newNames)
+{
+    Clear();
+    names.reserve(newNames.size());
+    hashes.reserve(newNames.size());
+    size_t capacity = 16;
+    while (capacity < 2 * newNames.size())
+        capacity <<= 1;
+    rehash(capacity);
+    for (size_t i = 0; i < newNames.size(); i++)
+        Add(newNames[i]);
+}
+
+int NameIndex::Add(const string &name)
+{
+    if (2 * (used + 1) > slots.size())
+        rehash(slots.empty() ? 16 : 2 * slots.size());
+    uint64_t h = hash(name.data(), name.length());
+    size_t slot = findSlot(name.data(), name.length(), h);
+    int id = names.size();
+    names.push_back(name);
+    hashes.push_back(h);
+    if (slots[slot] < 0)
+        used++;
+    slots[slot] = id;
+    return id;
+}
+
+int NameIndex::Find(const char *name, size_t length) const
+{
+    if (slots.empty())
+        return -1;
+    return slots[findSlot(name, length, hash(name, length))];
+}
+
+int NameIndex::Find(const string &name) const
+{
+    return Find(name.data(), name.length());
+}
+
+int NameIndex::Count() const
+{
+    return names.size();
+}
+
+const string &NameIndex::operator[] (int id) const
+{
+    return names[id];
+}
+
+void NameIndex::Clear()
+{
+    names.clear();
+    hashes.clear();
+    slots.clear();
+    used = 0;
+}
+
+// FNV-1a
+uint64_t NameIndex::hash(const char *name, size_t length)
+{
+    uint64_t h = 14695981039346656037ULL;
+    for (size_t i = 0; i < length; i++)
+    {
+        h ^= (unsigned char)name[i];
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+// returns the slot holding the name, or the empty slot where it would be inserted
+size_t NameIndex::findSlot(const char *name, size_t length, uint64_t h) const
+{
+    size_t mask = slots.size() - 1;
+    for (size_t slot = h & mask; ; slot = (slot + 1) & mask)
+    {
+        int id = slots[slot];
+        if (id < 0)
+            return slot;
+        if (hashes[id] == h && names[id].length() == length && memcmp(names[id].data(), name, length) == 0)
+            return slot;
+    }
+}
+
+void NameIndex::rehash(size_t capacity)
+{
+    vector<int> old;
+    old.swap(slots);
+    slots.assign(capacity, -1);
+    size_t mask = capacity - 1;
+    for (size_t i = 0; i < old.size(); i++)
+    {
+        if (old[i] < 0)
+            continue;
+        size_t slot = hashes[old[i]] & mask;
+        while (slots[slot] >= 0)
+            slot = (slot + 1) & mask;
+        slots[slot] = old[i];
+    }
+}
@@ -0,0 +1,69 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+#ifndef _NAMEINDEX_H
+#define _NAMEINDEX_H
+
+#include <cstddef>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Maps sequence names to their 0-based ids with an open addressing hash table.
+// Lookups take a pointer and a length, so names can be resolved straight from
+// a parsed line without building a string. As with map<string,int>, a repeated
+// name resolves to the id it was added with last.
+class NameIndex
+{
+public:
+    NameIndex();
+    NameIndex(const vector<string> &names);
+
+public:
+    void Assign(const vector<string> &names);
+    int Add(const string &name);
+    int Find(const char *name, size_t length) const;
+    int Find(const string &name) const;
+    int Count() const;
+    const string &operator[] (int id) const;
+    void Clear();
+
+private:
+    static uint64_t hash(const char *name, size_t length);
+    size_t findSlot(const char *name, size_t length, uint64_t h) const;
+    void rehash(size_t capacity);
+
+private:
+    vector<string> names;
+    vector<uint64_t> hashes;
+    vector<int> slots;
+    size_t used;
+};
+
+#endif
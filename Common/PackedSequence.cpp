@@ -0,0 +1,306 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+#include "PackedSequence.h"
+#include <cstring>
+#include <sstream>
+#include <algorithm>
+
+using namespace std;
+
+namespace
+{
+    // Four decoded bases for every possible byte of the packed array.
+    struct DecodeTable
+    {
+        DecodeTable()
+        {
+            static const char bases[] = "ACGT";
+            for (int i = 0; i < 256; i++)
+                for (int j = 0; j < 4; j++)
+                    Bases[i][j] = bases[(i >> (2 * j)) & 3];
+        }
+
+        char Bases[256][4];
+    };
+
+    const DecodeTable decodeTable;
+
+    inline int baseCode(char c)
+    {
+        switch (c)
+        {
+            case 'A' : return 0;
+            case 'C' : return 1;
+            case 'G' : return 2;
+            case 'T' : return 3;
+            default : return -1;
+        }
+    }
+
+    bool exceptionEndLess(uint64_t position, const PackedException &run)
+    {
+        return position < run.Start + run.Length;
+    }
+
+    bool maskEndLess(uint64_t position, const PackedMask &run)
+    {
+        return position < run.Start + run.Length;
+    }
+
+    // runs have to be non-empty, sorted, disjoint and inside the sequence
+    template <class Run> bool validRuns(const vector<Run> &runs, uint64_t length)
+    {
+        uint64_t end = 0;
+        for (typename vector<Run>::const_iterator it = runs.begin(); it != runs.end(); ++it)
+        {
+            if (it->Length == 0 || it->Start < end || it->Start > length || it->Length > length - it->Start)
+                return false;
+            end = it->Start + it->Length;
+        }
+        return true;
+    }
+}
+
+PackedSequence::PackedSequence()
+{
+}
+
+PackedSequence::PackedSequence(const string &nucleotides)
+{
+    Assign(nucleotides.data(), nucleotides.length());
+}
+
+PackedSequence::PackedSequence(const char *nucleotides, size_t length)
+{
+    Assign(nucleotides, length);
+}
+
+void PackedSequence::Assign(const string &nucleotides)
+{
+    Assign(nucleotides.data(), nucleotides.length());
+}
+
+void PackedSequence::Assign(const char *nucleotides, size_t length)
+{
+    if (length == 0)
+    {
+        data.reset();
+        return;
+    }
+
+    shared_ptr<Data> packed = make_shared<Data>();
+    packed->Length = length;
+    packed->Words.assign((length + 31) / 32, 0);
+    for (size_t i = 0; i < length; i++)
+    {
+        char c = nucleotides[i];
+        if (c >= 'a' && c <= 'z')
+        {
+            if (!packed->Masks.empty() && packed->Masks.back().Start + packed->Masks.back().Length == i)
+                packed->Masks.back().Length++;
+            else
+            {
+                PackedMask mask = { i, 1 };
+                packed->Masks.push_back(mask);
+            }
+            c += 'A' - 'a';
+        }
+
+        int code = baseCode(c);
+        if (code >= 0)
+            packed->Words[i >> 5] |= (uint64_t)code << ((i & 31) << 1);
+        else if (!packed->Exceptions.empty() && packed->Exceptions.back().Base == c &&
+                 packed->Exceptions.back().Start + packed->Exceptions.back().Length == i && packed->Exceptions.back().Length < UINT32_MAX)
+            packed->Exceptions.back().Length++;
+        else
+        {
+            PackedException exception = { i, 1, c };
+            packed->Exceptions.push_back(exception);
+        }
+    }
+    packed->Exceptions.shrink_to_fit();
+    packed->Masks.shrink_to_fit();
+    data = packed;
+}
+
+// Takes over an already packed sequence, as stored by Words, Exceptions and
+// Masks; the runs are swapped out of the given vectors.
+bool PackedSequence::Assign(size_t length, const uint64_t *words, vector<PackedException> &exceptions, vector<PackedMask> &masks)
+{
+    if (!validRuns(exceptions, length) || !validRuns(masks, length))
+        return false;
+    for (vector<PackedException>::const_iterator it = exceptions.begin(); it != exceptions.end(); ++it)
+        if (baseCode(it->Base) >= 0 || (it->Base >= 'a' && it->Base <= 'z'))
+            return false;
+    if (length == 0)
+    {
+        data.reset();
+        return true;
+    }
+
+    shared_ptr<Data> packed = make_shared<Data>();
+    packed->Length = length;
+    packed->Words.assign(words, words + (length + 31) / 32);
+    packed->Exceptions.swap(exceptions);
+    packed->Masks.swap(masks);
+    data = packed;
+    return true;
+}
+
+void PackedSequence::Clear()
+{
+    data.reset();
+}
+
+size_t PackedSequence::Length() const
+{
+    return data ? data->Length : 0;
+}
+
+bool PackedSequence::Empty() const
+{
+    return Length() == 0;
+}
+
+char PackedSequence::At(size_t i) const
+{
+    char base = decodeTable.Bases[(data->Words[i >> 5] >> ((i & 31) << 1)) & 3][0];
+    vector<PackedException>::const_iterator exception = upper_bound(data->Exceptions.begin(), data->Exceptions.end(), i, exceptionEndLess);
+    if (exception != data->Exceptions.end() && exception->Start <= i)
+        base = exception->Base;
+    vector<PackedMask>::const_iterator mask = upper_bound(data->Masks.begin(), data->Masks.end(), i, maskEndLess);
+    if (mask != data->Masks.end() && mask->Start <= i)
+        base += 'a' - 'A';
+    return base;
+}
+
+char PackedSequence::operator[] (size_t i) const
+{
+    return At(i);
+}
+
+void PackedSequence::Decode(string &nucleotides) const
+{
+    Decode(0, Length(), nucleotides);
+}
+
+void PackedSequence::Decode(size_t start, size_t length, string &nucleotides) const
+{
+    size_t total = Length();
+    if (start >= total)
+    {
+        nucleotides.clear();
+        return;
+    }
+    length = min(length, total - start);
+    nucleotides.resize(length);
+    char *out = &nucleotides[0];
+    decodeWords(*data, start, length, out);
+
+    size_t end = start + length;
+    for (vector<PackedException>::const_iterator it = upper_bound(data->Exceptions.begin(), data->Exceptions.end(), start, exceptionEndLess);
+         it != data->Exceptions.end() && it->Start < end; ++it)
+    {
+        size_t from = max((size_t)it->Start, start), to = min((size_t)(it->Start + it->Length), end);
+        memset(out + from - start, it->Base, to - from);
+    }
+    for (vector<PackedMask>::const_iterator it = upper_bound(data->Masks.begin(), data->Masks.end(), start, maskEndLess);
+         it != data->Masks.end() && it->Start < end; ++it)
+    {
+        size_t from = max((size_t)it->Start, start), to = min((size_t)(it->Start + it->Length), end);
+        for (size_t i = from; i < to; i++)
+            out[i - start] += 'a' - 'A';
+    }
+}
+
+string PackedSequence::ToString() const
+{
+    string nucleotides;
+    Decode(nucleotides);
+    return nucleotides;
+}
+
+size_t PackedSequence::MemoryUsage() const
+{
+    size_t size = sizeof(PackedSequence);
+    if (data)
+        size += sizeof(Data) + data->Words.capacity() * sizeof(uint64_t) + data->Exceptions.capacity() * sizeof(PackedException) + data->Masks.capacity() * sizeof(PackedMask);
+    return size;
+}
+
+const vector<uint64_t> &PackedSequence::Words() const
+{
+    static const vector<uint64_t> empty;
+    return data ? data->Words : empty;
+}
+
+const vector<PackedException> &PackedSequence::Exceptions() const
+{
+    static const vector<PackedException> empty;
+    return data ? data->Exceptions : empty;
+}
+
+const vector<PackedMask> &PackedSequence::Masks() const
+{
+    static const vector<PackedMask> empty;
+    return data ? data->Masks : empty;
+}
+
+void PackedSequence::decodeWords(const Data &data, size_t start, size_t length, char *out)
+{
+    const uint64_t *words = &data.Words[0];
+    size_t i = 0, position = start;
+    // unaligned head, then four bases per byte of the packed array
+    for (; i < length && (position & 3); i++, position++)
+        *out++ = decodeTable.Bases[(words[position >> 5] >> ((position & 31) << 1)) & 3][0];
+    for (; i + 4 <= length; i += 4, position += 4, out += 4)
+        memcpy(out, decodeTable.Bases[(words[position >> 5] >> ((position & 31) << 1)) & 0xff], 4);
+    for (; i < length; i++, position++)
+        *out++ = decodeTable.Bases[(words[position >> 5] >> ((position & 31) << 1)) & 3][0];
+}
+
+string PackedFastASequence::Name() const
+{
+    stringstream in(Comment);
+    string name;
+    in >> name;
+    return name;
+}
+
+FastASequence PackedFastASequence::Unpack() const
+{
+    FastASequence seq;
+    Unpack(seq);
+    return seq;
+}
+
+void PackedFastASequence::Unpack(FastASequence &seq) const
+{
+    Nucleotides.Decode(seq.Nucleotides);
+    seq.Comment = Comment;
+}
@@ -0,0 +1,118 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+#ifndef _PACKEDSEQUENCE_H
+#define _PACKEDSEQUENCE_H
+
+#include <cstddef>
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <memory>
+#include "Sequence.h"
+
+using namespace std;
+
+// A run of identical bases that can not be stored in two bits (N and IUPAC codes).
+struct PackedException
+{
+    uint64_t Start;
+    uint32_t Length;
+    char Base;
+};
+
+// A run of soft-masked (lowercase) bases.
+struct PackedMask
+{
+    uint64_t Start;
+    uint64_t Length;
+};
+
+// Nucleotide sequence stored with two bits per base. Everything that is not
+// A/C/G/T is kept in a sorted list of runs, so decoding is lossless. The packed
+// data is immutable and shared between copies, which makes copying a contig
+// (and hence a DataStore) cheap.
+class PackedSequence
+{
+public:
+    PackedSequence();
+    PackedSequence(const string &nucleotides);
+    PackedSequence(const char *nucleotides, size_t length);
+
+public:
+    void Assign(const string &nucleotides);
+    void Assign(const char *nucleotides, size_t length);
+    bool Assign(size_t length, const uint64_t *words, vector<PackedException> &exceptions, vector<PackedMask> &masks);
+    void Clear();
+    size_t Length() const;
+    bool Empty() const;
+    char At(size_t i) const;
+    char operator[] (size_t i) const;
+    void Decode(string &nucleotides) const;
+    void Decode(size_t start, size_t length, string &nucleotides) const;
+    string ToString() const;
+    size_t MemoryUsage() const;
+    // the packed representation, (Length() + 31) / 32 words of two-bit codes
+    const vector<uint64_t> &Words() const;
+    const vector<PackedException> &Exceptions() const;
+    const vector<PackedMask> &Masks() const;
+
+private:
+    struct Data
+    {
+        Data() : Length(0) {};
+
+        uint64_t Length;
+        vector<uint64_t> Words;
+        vector<PackedException> Exceptions;
+        vector<PackedMask> Masks;
+    };
+
+    static void decodeWords(const Data &data, size_t start, size_t length, char *out);
+
+private:
+    shared_ptr<const Data> data;
+};
+
+class PackedFastASequence
+{
+public:
+    PackedFastASequence() {};
+    PackedFastASequence(const FastASequence &seq) : Nucleotides(seq.Nucleotides), Comment(seq.Comment) {};
+    PackedFastASequence(const PackedSequence &nucleotides, const string &comment) : Nucleotides(nucleotides), Comment(comment) {};
+
+public:
+    string Name() const;
+    FastASequence Unpack() const;
+    void Unpack(FastASequence &seq) const;
+
+public:
+    PackedSequence Nucleotides;
+    string Comment;
+};
+
+#endif
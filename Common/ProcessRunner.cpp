@@ -0,0 +1,377 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+#include "ProcessRunner.h"
+
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <chrono>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <spawn.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+extern char **environ;
+
+namespace
+{
+    const size_t PipeBufferSize = 1 << 16;
+
+    double toSeconds(const timeval &time)
+    {
+        return time.tv_sec + time.tv_usec / 1e6;
+    }
+
+    bool redirect(posix_spawn_file_actions_t &actions, int fd, ProcessOutput output, const string &fileName, int pipeEnd)
+    {
+        switch (output)
+        {
+        case DiscardOutput:
+            return posix_spawn_file_actions_addopen(&actions, fd, "/dev/null", O_WRONLY, 0) == 0;
+        case FileOutput:
+            return posix_spawn_file_actions_addopen(&actions, fd, fileName.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644) == 0;
+        case PipeOutput:
+            return posix_spawn_file_actions_adddup2(&actions, pipeEnd, fd) == 0;
+        default:
+            return true;
+        }
+    }
+}
+
+ProcessJob::ProcessJob(const string &program, initializer_list<string> arguments)
+    : Program(program), Arguments(arguments), Stdout(InheritOutput), Stderr(InheritOutput)
+{
+}
+
+ProcessJob &ProcessJob::Add(const string &argument)
+{
+    Arguments.push_back(argument);
+    return *this;
+}
+
+ProcessJob &ProcessJob::Add(long long argument)
+{
+    Arguments.push_back(to_string(argument));
+    return *this;
+}
+
+bool ProcessJob::Succeeded() const
+{
+    return Stats.ExitCode == 0;
+}
+
+string ProcessJob::CommandLine() const
+{
+    string line = Program;
+    for (size_t i = 0; i < Arguments.size(); i++)
+        line += " " + Arguments[i];
+    if (Stdout == FileOutput)
+        line += " > " + StdoutFile;
+    if (Stderr == FileOutput)
+        line += " 2> " + StderrFile;
+    return line;
+}
+
+ProcessRunner::ProcessRunner(int concurrent)
+    : concurrent(concurrent < 1 ? 1 : concurrent), active(0), cancelled(false), succeeded(true)
+{
+}
+
+ProcessRunner::~ProcessRunner()
+{
+    Wait();
+}
+
+void ProcessRunner::Submit(ProcessJob &job)
+{
+    lock_guard<mutex> guard(lock);
+    queue.push_back(&job);
+    if (active < concurrent)
+    {
+        active++;
+        workers.push_back(thread(&ProcessRunner::worker, this));
+    }
+}
+
+bool ProcessRunner::Wait()
+{
+    for (size_t i = 0; i < workers.size(); i++)
+        workers[i].join();
+    workers.clear();
+
+    lock_guard<mutex> guard(lock);
+    bool result = succeeded && !cancelled;
+    succeeded = true;
+    cancelled = false;
+    return result;
+}
+
+void ProcessRunner::Cancel()
+{
+    lock_guard<mutex> guard(lock);
+    cancelled = true;
+    queue.clear();
+    for (set<pid_t>::iterator it = running.begin(); it != running.end(); it++)
+        kill(*it, SIGTERM);
+}
+
+bool ProcessRunner::Run(ProcessJob &job)
+{
+    Submit(job);
+    return Wait() && job.Succeeded();
+}
+
+const vector<ProcessStats> &ProcessRunner::GetHistory() const
+{
+    return history;
+}
+
+bool ProcessRunner::Execute(ProcessJob &job)
+{
+    return execute(job, NULL);
+}
+
+void ProcessRunner::worker()
+{
+    while (true)
+    {
+        ProcessJob *job;
+        {
+            lock_guard<mutex> guard(lock);
+            if (queue.empty())
+            {
+                active--;
+                return;
+            }
+            job = queue.front();
+            queue.pop_front();
+        }
+
+        bool result = execute(*job, this);
+
+        lock_guard<mutex> guard(lock);
+        succeeded = succeeded && result;
+        history.push_back(job->Stats);
+    }
+}
+
+bool ProcessRunner::execute(ProcessJob &job, ProcessRunner *owner)
+{
+    pid_t pid;
+    int out, err;
+    auto start = chrono::steady_clock::now();
+    if (!spawn(job, pid, out, err))
+        return false;
+
+    if (owner)
+    {
+        lock_guard<mutex> guard(owner->lock);
+        owner->running.insert(pid);
+        // a cancel may have slipped in between spawning and registering the child
+        if (owner->cancelled)
+            kill(pid, SIGTERM);
+    }
+
+    collect(job, out, err);
+    reap(job, pid, start);
+
+    if (owner)
+    {
+        lock_guard<mutex> guard(owner->lock);
+        owner->running.erase(pid);
+    }
+    return job.Succeeded();
+}
+
+bool ProcessRunner::spawn(ProcessJob &job, pid_t &pid, int &out, int &err)
+{
+    int outPipe[2] = { -1, -1 }, errPipe[2] = { -1, -1 };
+    job.Stats = ProcessStats();
+    job.Stats.Program = job.Program;
+
+    if ((job.Stdout == PipeOutput && pipe2(outPipe, O_CLOEXEC) != 0) || (job.Stderr == PipeOutput && pipe2(errPipe, O_CLOEXEC) != 0))
+    {
+        cerr << "[-] Unable to create pipe for " << job.Program << " (" << strerror(errno) << ")." << endl;
+        // the first pipe may have been created before the second one failed
+        for (int i = 0; i < 2; i++)
+        {
+            if (outPipe[i] >= 0)
+                close(outPipe[i]);
+            if (errPipe[i] >= 0)
+                close(errPipe[i]);
+        }
+        return false;
+    }
+
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    bool prepared = redirect(actions, STDOUT_FILENO, job.Stdout, job.StdoutFile, outPipe[1]) && redirect(actions, STDERR_FILENO, job.Stderr, job.StderrFile, errPipe[1]);
+
+    vector<char *> argv;
+    argv.push_back(const_cast<char *>(job.Program.c_str()));
+    for (size_t i = 0; i < job.Arguments.size(); i++)
+        argv.push_back(const_cast<char *>(job.Arguments[i].c_str()));
+    argv.push_back(NULL);
+
+    int error = prepared ? posix_spawnp(&pid, job.Program.c_str(), &actions, NULL, &argv[0], environ) : ENOMEM;
+    posix_spawn_file_actions_destroy(&actions);
+
+    // the write ends now belong to the child
+    if (outPipe[1] >= 0)
+        close(outPipe[1]);
+    if (errPipe[1] >= 0)
+        close(errPipe[1]);
+    out = outPipe[0];
+    err = errPipe[0];
+
+    if (error != 0)
+    {
+        cerr << "[-] Unable to start " << job.Program << " (" << strerror(error) << ")." << endl;
+        if (out >= 0)
+            close(out);
+        if (err >= 0)
+            close(err);
+        return false;
+    }
+    return true;
+}
+
+// Waits for the child and records its exit code and resource usage.
+void ProcessRunner::reap(ProcessJob &job, pid_t pid, chrono::steady_clock::time_point start)
+{
+    int status = 0;
+    rusage usage;
+    memset(&usage, 0, sizeof(usage));
+    pid_t result;
+    while ((result = wait4(pid, &status, 0, &usage)) < 0 && errno == EINTR);
+
+    job.Stats.WallTime = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    job.Stats.UserTime = toSeconds(usage.ru_utime);
+    job.Stats.SystemTime = toSeconds(usage.ru_stime);
+    job.Stats.PeakMemory = usage.ru_maxrss;
+    // a child that could not be waited for is lost, which counts as a failure
+    job.Stats.ExitCode = result == pid && WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+void ProcessRunner::collect(ProcessJob &job, int out, int err)
+{
+    vector<char> buffer(PipeBufferSize);
+    pollfd fds[2];
+    function<void (const char *, size_t)> *handlers[2] = { &job.StdoutHandler, &job.StderrHandler };
+    fds[0].fd = out;
+    fds[1].fd = err;
+    fds[0].events = fds[1].events = POLLIN;
+
+    while (fds[0].fd >= 0 || fds[1].fd >= 0)
+    {
+        // negative descriptors are ignored by poll
+        if (poll(fds, 2, -1) < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+        for (int i = 0; i < 2; i++)
+        {
+            if (fds[i].fd < 0 || fds[i].revents == 0)
+                continue;
+            ssize_t count = read(fds[i].fd, &buffer[0], buffer.size());
+            if (count > 0)
+            {
+                if (*handlers[i])
+                    (*handlers[i])(&buffer[0], count);
+            }
+            else if (count == 0 || errno != EINTR)
+            {
+                close(fds[i].fd);
+                fds[i].fd = -1;
+            }
+        }
+    }
+
+    for (int i = 0; i < 2; i++)
+    {
+        if (fds[i].fd >= 0)
+            close(fds[i].fd);
+    }
+}
+
+ProcessPipe::ProcessPipe()
+    : job(NULL), pid(-1), fd(-1)
+{
+}
+
+ProcessPipe::~ProcessPipe()
+{
+    Close();
+}
+
+bool ProcessPipe::Open(ProcessJob &job)
+{
+    Close();
+    job.Stdout = PipeOutput;
+    if (job.Stderr == PipeOutput)
+        job.Stderr = DiscardOutput;
+    start = chrono::steady_clock::now();
+    int err;
+    if (!ProcessRunner::spawn(job, pid, fd, err))
+        return false;
+    this->job = &job;
+    return true;
+}
+
+bool ProcessPipe::Close()
+{
+    if (!job)
+        return false;
+    // a reader that stops early must not turn a healthy child into a SIGPIPE casualty
+    vector<char> buffer(PipeBufferSize);
+    ssize_t count;
+    while ((count = read(fd, &buffer[0], buffer.size())) > 0 || (count < 0 && errno == EINTR));
+    close(fd);
+    ProcessRunner::reap(*job, pid, start);
+
+    bool result = job->Succeeded();
+    job = NULL;
+    pid = -1;
+    fd = -1;
+    return result;
+}
+
+bool ProcessPipe::IsOpen() const
+{
+    return job != NULL;
+}
+
+int ProcessPipe::GetDescriptor() const
+{
+    return fd;
+}
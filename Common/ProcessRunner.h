@@ -0,0 +1,153 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+/*
+ * Runs external programs (aligners, samtools, MUMmer) without a shell. Children
+ * are started with posix_spawnp from an argument vector, their output can be
+ * inherited, discarded, redirected to a file or streamed back through a pipe,
+ * and up to a given number of jobs run at the same time. Wall time, CPU time
+ * and peak resident memory are recorded for every child.
+ */
+
+#ifndef _PROCESSRUNNER_H
+#define _PROCESSRUNNER_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <deque>
+#include <set>
+#include <thread>
+#include <mutex>
+#include <functional>
+#include <chrono>
+#include <initializer_list>
+#include <sys/types.h>
+
+using namespace std;
+
+struct ProcessStats
+{
+    ProcessStats() : WallTime(0), UserTime(0), SystemTime(0), PeakMemory(0), ExitCode(-1) {};
+
+    string Program;
+    // seconds
+    double WallTime;
+    double UserTime;
+    double SystemTime;
+    // peak resident set size in kilobytes
+    long PeakMemory;
+    // -1 if the program could not be started, was killed or was cancelled
+    int ExitCode;
+};
+
+enum ProcessOutput { InheritOutput, DiscardOutput, FileOutput, PipeOutput };
+
+class ProcessJob
+{
+public:
+    ProcessJob(const string &program = string(), initializer_list<string> arguments = initializer_list<string>());
+
+public:
+    ProcessJob &Add(const string &argument);
+    ProcessJob &Add(long long argument);
+    bool Succeeded() const;
+    string CommandLine() const;
+
+public:
+    string Program;
+    vector<string> Arguments;
+    ProcessOutput Stdout, Stderr;
+    string StdoutFile, StderrFile;
+    // called with chunks of output when the stream is a PipeOutput
+    function<void (const char *, size_t)> StdoutHandler, StderrHandler;
+    ProcessStats Stats;
+};
+
+class ProcessRunner
+{
+public:
+    ProcessRunner(int concurrent = 1);
+    ~ProcessRunner();
+
+public:
+    // the job is run as soon as a slot is free and must stay alive until Wait returns
+    void Submit(ProcessJob &job);
+    // waits for all submitted jobs, true if every one of them succeeded
+    bool Wait();
+    // terminates running children and drops queued jobs
+    void Cancel();
+    bool Run(ProcessJob &job);
+    const vector<ProcessStats> &GetHistory() const;
+
+public:
+    static bool Execute(ProcessJob &job);
+
+private:
+    friend class ProcessPipe;
+
+    void worker();
+    static bool execute(ProcessJob &job, ProcessRunner *owner);
+    static bool spawn(ProcessJob &job, pid_t &pid, int &out, int &err);
+    static void collect(ProcessJob &job, int out, int err);
+    static void reap(ProcessJob &job, pid_t pid, chrono::steady_clock::time_point start);
+
+private:
+    int concurrent;
+    int active;
+    bool cancelled;
+    bool succeeded;
+    deque<ProcessJob *> queue;
+    vector<thread> workers;
+    set<pid_t> running;
+    vector<ProcessStats> history;
+    mutex lock;
+};
+
+// A running child whose stdout is read by the caller, e.g. an aligner streaming SAM.
+class ProcessPipe
+{
+public:
+    ProcessPipe();
+    ~ProcessPipe();
+
+public:
+    // stdout is always piped, stderr follows job.Stderr (a pipe is discarded); the job must outlive Close
+    bool Open(ProcessJob &job);
+    // drains the remaining output and waits for the child, true if it succeeded
+    bool Close();
+    bool IsOpen() const;
+    int GetDescriptor() const;
+
+private:
+    ProcessJob *job;
+    pid_t pid;
+    int fd;
+    chrono::steady_clock::time_point start;
+};
+
+#endif
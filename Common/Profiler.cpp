@@ -0,0 +1,243 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+#include "Profiler.h"
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <vector>
+#include <unistd.h>
+
+using namespace std;
+
+namespace
+{
+    struct Counter
+    {
+        const char *Name;
+        long long Value;
+        int Next;
+    };
+
+    struct Event
+    {
+        const char *Name;
+        long long Start, End;
+        long long Children;
+        int Parent;
+        int Counters;
+    };
+
+    struct ThreadBuffer
+    {
+        int Id;
+        int Current;
+        vector<Event> Events;
+        vector<Counter> Counters;
+    };
+
+    struct Totals
+    {
+        Totals() : Calls(0), Total(0), Self(0), Max(0) { }
+
+        long long Calls, Total, Self, Max;
+    };
+
+    mutex profileLock;
+    // buffers live until exit, pooled threads keep appending to theirs
+    vector<ThreadBuffer *> buffers;
+    thread_local ThreadBuffer *local = NULL;
+    const chrono::steady_clock::time_point origin = chrono::steady_clock::now();
+
+    long long now()
+    {
+        return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - origin).count();
+    }
+
+    ThreadBuffer *threadBuffer()
+    {
+        if (local == NULL)
+        {
+            ThreadBuffer *buffer = new ThreadBuffer();
+            buffer->Current = -1;
+            lock_guard<mutex> guard(profileLock);
+            buffer->Id = buffers.size();
+            buffers.push_back(buffer);
+            local = buffer;
+        }
+        return local;
+    }
+
+    long long endOf(const Event &event, long long time)
+    {
+        return (event.End < 0 ? time : event.End);
+    }
+
+    void writeString(FILE *out, const char *value)
+    {
+        fputc('"', out);
+        for (; *value; value++)
+        {
+            if (*value == '"' || *value == '\\')
+                fputc('\\', out);
+            if ((unsigned char)*value >= 0x20)
+                fputc(*value, out);
+        }
+        fputc('"', out);
+    }
+
+    bool compareTotals(const pair<string, Totals> &a, const pair<string, Totals> &b)
+    {
+        return a.second.Total > b.second.Total;
+    }
+}
+
+namespace Profiler
+{
+    bool Enabled = false;
+
+    void Enable(bool enable)
+    {
+        Enabled = enable;
+    }
+
+    bool IsEnabled()
+    {
+        return Enabled;
+    }
+
+    bool WriteTrace(const string &fileName)
+    {
+        FILE *out = fopen(fileName.c_str(), "w");
+        if (out == NULL)
+            return false;
+        lock_guard<mutex> guard(profileLock);
+        long long time = now();
+        int pid = getpid();
+        bool first = true;
+        fprintf(out, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+        for (size_t i = 0; i < buffers.size(); i++)
+        {
+            const ThreadBuffer &buffer = *buffers[i];
+            fprintf(out, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%i,\"tid\":%i,\"args\":{\"name\":\"%s %i\"}}",
+                    (first ? "" : ","), pid, buffer.Id, (buffer.Id == 0 ? "main" : "worker"), buffer.Id);
+            first = false;
+            for (size_t j = 0; j < buffer.Events.size(); j++)
+            {
+                const Event &event = buffer.Events[j];
+                fprintf(out, ",\n{\"name\":");
+                writeString(out, event.Name);
+                fprintf(out, ",\"cat\":\"grass\",\"ph\":\"X\",\"pid\":%i,\"tid\":%i,\"ts\":%.3lf,\"dur\":%.3lf",
+                        pid, buffer.Id, event.Start / 1000.0, (endOf(event, time) - event.Start) / 1000.0);
+                if (event.Counters >= 0)
+                {
+                    fprintf(out, ",\"args\":{");
+                    for (int c = event.Counters; c >= 0; c = buffer.Counters[c].Next)
+                    {
+                        writeString(out, buffer.Counters[c].Name);
+                        fprintf(out, ":%lld%s", buffer.Counters[c].Value, (buffer.Counters[c].Next >= 0 ? "," : ""));
+                    }
+                    fputc('}', out);
+                }
+                fputc('}', out);
+            }
+        }
+        fprintf(out, "\n]}\n");
+        return fclose(out) == 0;
+    }
+
+    void WriteSummary(FILE *out)
+    {
+        map<string, Totals> totals;
+        {
+            lock_guard<mutex> guard(profileLock);
+            long long time = now();
+            for (size_t i = 0; i < buffers.size(); i++)
+                for (size_t j = 0; j < buffers[i]->Events.size(); j++)
+                {
+                    const Event &event = buffers[i]->Events[j];
+                    long long duration = endOf(event, time) - event.Start;
+                    Totals &item = totals[event.Name];
+                    item.Calls++;
+                    item.Total += duration;
+                    item.Self += duration - event.Children;
+                    item.Max = max(item.Max, duration);
+                }
+        }
+        vector< pair<string, Totals> > sorted(totals.begin(), totals.end());
+        sort(sorted.begin(), sorted.end(), compareTotals);
+        fprintf(out, "[i] Profile summary (times in ms, totals summed over threads):\n");
+        fprintf(out, "    %-32s %10s %14s %14s %12s\n", "scope", "calls", "total", "self", "max");
+        for (size_t i = 0; i < sorted.size(); i++)
+        {
+            const Totals &item = sorted[i].second;
+            fprintf(out, "    %-32s %10lld %14.3lf %14.3lf %12.3lf\n", sorted[i].first.c_str(), item.Calls,
+                    item.Total / 1e6, item.Self / 1e6, item.Max / 1e6);
+        }
+    }
+}
+
+void ProfileScope::open(const char *name)
+{
+    ThreadBuffer *buffer = threadBuffer();
+    Event item;
+    item.Name = name;
+    item.Start = now();
+    item.End = -1;
+    item.Children = 0;
+    item.Parent = buffer->Current;
+    item.Counters = -1;
+    event = buffer->Events.size();
+    buffer->Events.push_back(item);
+    buffer->Current = event;
+}
+
+void ProfileScope::close()
+{
+    ThreadBuffer *buffer = local;
+    Event &item = buffer->Events[event];
+    item.End = now();
+    buffer->Current = item.Parent;
+    if (item.Parent >= 0)
+        buffer->Events[item.Parent].Children += item.End - item.Start;
+}
+
+void ProfileScope::count(const char *name, long long value)
+{
+    ThreadBuffer *buffer = local;
+    Event &item = buffer->Events[event];
+    for (int c = item.Counters; c >= 0; c = buffer->Counters[c].Next)
+        if (buffer->Counters[c].Name == name)
+        {
+            buffer->Counters[c].Value += value;
+            return;
+        }
+    Counter counter = { name, value, item.Counters };
+    item.Counters = buffer->Counters.size();
+    buffer->Counters.push_back(counter);
+}
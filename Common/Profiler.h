@@ -0,0 +1,96 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+/*
+ * Scoped wall clock profiler. A ProfileScope records one event from its
+ * construction to its destruction on a steady clock, nested events form the
+ * call hierarchy of the thread that opened them. Every thread appends to its
+ * own buffer, so recording takes no locks; the buffers are only read by the
+ * Write functions, which are meant to be called once the worker threads are
+ * idle (typically at the end of main). Scopes cost a single flag test while
+ * profiling is disabled.
+ */
+
+#ifndef _PROFILER_H
+#define _PROFILER_H
+
+#include <cstdio>
+#include <string>
+
+using namespace std;
+
+namespace Profiler
+{
+    void Enable(bool enable = true);
+    bool IsEnabled();
+
+    // Chrome trace_event JSON, load it in chrome://tracing or Perfetto
+    bool WriteTrace(const string &fileName);
+    // flat per scope totals: calls, inclusive and exclusive time, longest call
+    void WriteSummary(FILE *out);
+
+    extern bool Enabled;
+}
+
+// Scope and counter names are kept by pointer, pass string literals.
+class ProfileScope
+{
+public:
+    explicit ProfileScope(const char *name)
+        : event(-1)
+    {
+        if (Profiler::Enabled)
+            open(name);
+    }
+
+    ~ProfileScope()
+    {
+        if (event >= 0)
+            close();
+    }
+
+    // Attaches a named value to this scope, shown as an argument in the trace;
+    // repeated calls with the same name add up.
+    void Count(const char *name, long long value)
+    {
+        if (event >= 0)
+            count(name, value);
+    }
+
+private:
+    ProfileScope(const ProfileScope &);
+    ProfileScope &operator=(const ProfileScope &);
+
+    void open(const char *name);
+    void close();
+    void count(const char *name, long long value);
+
+private:
+    int event;
+};
+
+#endif
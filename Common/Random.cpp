@@ -0,0 +1,130 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+#include "Random.h"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <unistd.h>
+
+using namespace std;
+
+namespace
+{
+    // streams of Random::Local(), kept apart from the ones handed to Derive
+    const uint64_t LocalStreams = 0xffffffff00000000ULL;
+
+    atomic<uint64_t> runSeed(0);
+    atomic<unsigned> epoch(1);
+    atomic<unsigned> slots(0);
+
+    struct ThreadGenerator
+    {
+        RandomGenerator Generator;
+        unsigned Epoch;
+    };
+
+    thread_local ThreadGenerator local = { RandomGenerator(), 0 };
+
+    uint64_t splitmix(uint64_t &x)
+    {
+        uint64_t z = (x += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+}
+
+RandomGenerator::RandomGenerator(uint64_t seed, uint64_t stream)
+{
+    Seed(seed, stream);
+}
+
+void RandomGenerator::Seed(uint64_t seed, uint64_t stream)
+{
+    uint64_t x = seed;
+    uint64_t y = stream ^ 0x6a09e667f3bcc909ULL;
+    x = splitmix(x) ^ splitmix(y);
+    for (int i = 0; i < 4; i++)
+        state[i] = splitmix(x);
+}
+
+double RandomGenerator::NextNormal(double mean, double std)
+{
+    // Box-Muller, 1 - u keeps the logarithm finite
+    double u = 1.0 - NextDouble();
+    double v = NextDouble();
+    return mean + std * sqrt(-2 * log(u)) * sin(2 * M_PI * v);
+}
+
+namespace Random
+{
+    uint64_t CreateSeed()
+    {
+        uint64_t seed = chrono::high_resolution_clock::now().time_since_epoch().count() ^ ((uint64_t)getpid() << 32);
+        try
+        {
+            random_device device;
+            seed ^= ((uint64_t)device() << 32) | device();
+        }
+        catch (...)
+        {
+        }
+        uint64_t x = seed;
+        return splitmix(x) >> 1; // fits a signed 64-bit value, easy to pass back on the command line
+    }
+
+    void SetSeed(uint64_t seed)
+    {
+        runSeed = seed;
+        slots = 1;
+        local.Generator.Seed(seed, LocalStreams);
+        local.Epoch = ++epoch;
+    }
+
+    uint64_t GetSeed()
+    {
+        return runSeed;
+    }
+
+    RandomGenerator Derive(uint64_t stream)
+    {
+        return RandomGenerator(runSeed, stream);
+    }
+
+    RandomGenerator &Local()
+    {
+        unsigned current = epoch;
+        if (local.Epoch != current)
+        {
+            local.Generator.Seed(runSeed, LocalStreams + slots++);
+            local.Epoch = current;
+        }
+        return local.Generator;
+    }
+}
@@ -0,0 +1,133 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+/*
+ * Random numbers for solvers and simulators. RandomGenerator is xoshiro256**
+ * seeded through splitmix64 from a (seed, stream) pair, so any number of
+ * independent generators can be derived from the single run seed. Code that
+ * runs in parallel should derive a generator per work item (for example from
+ * the item index) rather than share one, which keeps results independent of
+ * the thread count and scheduling. Random::Local() is a per-thread generator
+ * for sequential code and for callers that do not care about replay.
+ */
+
+#ifndef _RANDOMGENERATOR_H
+#define _RANDOMGENERATOR_H
+
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+using namespace std;
+
+class RandomGenerator
+{
+public:
+    typedef uint64_t result_type;
+
+    explicit RandomGenerator(uint64_t seed = 0, uint64_t stream = 0);
+
+    void Seed(uint64_t seed, uint64_t stream = 0);
+
+    uint64_t Next()
+    {
+        uint64_t result = rotate(state[1] * 5, 7) * 9;
+        uint64_t t = state[1] << 17;
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotate(state[3], 45);
+        return result;
+    }
+
+    // uniform in [0, n), n > 0
+    int NextInt(int n)
+    {
+        return (int)(((Next() >> 32) * (uint64_t)n) >> 32);
+    }
+
+    // uniform in [0, 1)
+    double NextDouble()
+    {
+        return (Next() >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+    bool NextBool()
+    {
+        return (Next() >> 63) != 0;
+    }
+
+    // true with probability p
+    bool NextBool(double p)
+    {
+        return NextDouble() < p;
+    }
+
+    double NextNormal(double mean = 0.0, double std = 1.0);
+
+    template<class Iterator>
+    void Shuffle(Iterator first, Iterator last)
+    {
+        for (int i = (int)(last - first) - 1; i > 0; i--)
+        {
+            int j = NextInt(i + 1);
+            if (i != j)
+                swap(first[i], first[j]);
+        }
+    }
+
+    // UniformRandomBitGenerator, for use with the <random> distributions
+    static result_type min() { return 0; }
+    static result_type max() { return numeric_limits<result_type>::max(); }
+    result_type operator()() { return Next(); }
+
+private:
+    static uint64_t rotate(uint64_t x, int k)
+    {
+        return (x << k) | (x >> (64 - k));
+    }
+
+private:
+    uint64_t state[4];
+};
+
+namespace Random
+{
+    // a seed from the system entropy source, for runs without -seed
+    uint64_t CreateSeed();
+    // sets the run seed and reseeds the generators of all threads
+    void SetSeed(uint64_t seed);
+    uint64_t GetSeed();
+    // a generator for an independent stream of the run seed
+    RandomGenerator Derive(uint64_t stream);
+    // the calling thread's generator; the thread that called SetSeed gets stream 0
+    RandomGenerator &Local();
+}
+
+#endif
@@ -26,6 +26,9 @@
  */
 
 #include "ReadCoverage.h"
+#include <algorithm>
+
+using namespace std;
 
 ReadCoverage::ReadCoverage(int contigCount)
         : ReadLocations(contigCount)
@@ -33,6 +36,8 @@ ReadCoverage::ReadCoverage(int contigCount)
     TotalReadCount = 0;
     AverageReadLength = 0;
     TotalReadLength = 0;
+    Summarized = false;
+    Resolution = 0;
 }
 
 int ReadCoverage::GetContigCount() const
@@ -43,6 +48,8 @@ int ReadCoverage::GetContigCount() const
 void ReadCoverage::SetContigCount(int count)
 {
     ReadLocations.resize(count, vector<int>());
+    if (Summarized)
+        Summaries.resize(count);
 }
 
 void ReadCoverage::AddLocation(int id, int location)
@@ -50,6 +57,45 @@ void ReadCoverage::AddLocation(int id, int location)
     ReadLocations[id].push_back(location);
 }
 
+void ReadCoverage::Summarize(const vector<int> &contigLengths, int resolution)
+{
+    int nContigs = contigLengths.size();
+    Summarized = true;
+    Resolution = max(resolution, 0);
+    ReadLocations.assign(nContigs, vector<int>());
+    Summaries.assign(nContigs, ReadCoverageSummary());
+    for (int i = 0; i < nContigs; i++)
+    {
+        Summaries[i].Length = contigLengths[i];
+        if (Resolution > 0)
+            Summaries[i].Histogram.resize((contigLengths[i] + Resolution - 1) / Resolution, 0);
+    }
+}
+
+void ReadCoverage::AddRead(int id, int location, int readLength)
+{
+    UpdateAverage(readLength);
+    if (!Summarized)
+    {
+        AddLocation(id, location);
+        return;
+    }
+
+    ReadCoverageSummary &summary = Summaries[id];
+    int end = location + readLength;
+    if (location >= 0 && location < summary.Length)
+    {
+        summary.Starts++;
+        if (!summary.Histogram.empty())
+            summary.Histogram[location / Resolution]++;
+    }
+    if (location >= 0 && end <= summary.Length)
+        summary.Contained++;
+    int overlap = min(end, summary.Length) - max(location, 0);
+    if (overlap > 0)
+        summary.Bases += overlap;
+}
+
 void ReadCoverage::UpdateAverage(int readLength)
 {
     TotalReadLength += readLength;
@@ -61,5 +107,5 @@ void ReadCoverage::SetAverageReadLength(long long totalReadLength, int totalRead
 {
     TotalReadLength = totalReadLength;
     TotalReadCount = totalReadCount;
-    AverageReadLength = (double)totalReadLength / (double)totalReadCount;
+    AverageReadLength = (totalReadCount > 0 ? (double)totalReadLength / (double)totalReadCount : 0);
 }
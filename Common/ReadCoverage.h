@@ -40,6 +40,22 @@
 
 using namespace std;
 
+// Compact description of the reads on a contig, kept instead of their start positions.
+struct ReadCoverageSummary
+{
+    ReadCoverageSummary() : Length(0), Starts(0), Contained(0), Bases(0) {}
+
+    int Length;
+    // reads starting inside the contig
+    long long Starts;
+    // reads lying completely inside the contig
+    long long Contained;
+    // read bases overlapping the contig
+    long long Bases;
+    // read starts per Resolution bases of the contig, empty when disabled
+    vector<int> Histogram;
+};
+
 class ReadCoverage
 {
 public:
@@ -51,9 +67,17 @@ public:
     void AddLocation(int id, int location);
     void UpdateAverage(int readLength);
     void SetAverageReadLength(long long totalReadLength, int totalReadCount);
+    // keeps per contig summaries from now on instead of read locations,
+    // resolution > 0 also keeps a histogram of read starts with bins of that many bases
+    void Summarize(const vector<int> &contigLengths, int resolution = 0);
+    // records a read, either as a location or in the summary of its contig
+    void AddRead(int id, int location, int readLength);
     
 public:
     vector< vector<int> > ReadLocations;
+    bool Summarized;
+    int Resolution;
+    vector<ReadCoverageSummary> Summaries;
     double AverageReadLength;
     int TotalReadCount;
     long long TotalReadLength;
@@ -0,0 +1,91 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+/*
+ * On-disk layout of the binary read coverage format. The header is followed by
+ * an index with one entry per contig and a data section. The read positions of
+ * every contig are stored sorted: the first position as a zigzag varint and the
+ * others as varint deltas to their predecessor. The index holds the location of
+ * each contig's positions, so a single contig can be decoded on its own.
+ * Summarized coverage stores a table of per contig summaries instead, and the
+ * index then points to the varint encoded start histograms.
+ */
+
+#ifndef _READCOVERAGEFORMAT_H
+#define _READCOVERAGEFORMAT_H
+
+#include <stdint.h>
+
+enum ReadCoverageFileFormat
+{
+    TextReadCoverage,
+    BinaryReadCoverage
+};
+
+const char ReadCoverageMagic[8] = { 'G', 'R', 'A', 'S', 'S', 'R', 'C', '\0' };
+// version 2 added the summary flags, resolution and table
+const uint32_t ReadCoverageVersion = 2;
+const uint32_t ReadCoverageByteOrder = 0x01020304;
+
+// bits of the header flags
+const uint32_t ReadCoverageSummarized = 1;
+
+struct ReadCoverageHeader
+{
+    char Magic[8];
+    uint32_t Version;
+    uint32_t ByteOrder;
+    double AverageReadLength;
+    int64_t TotalReadLength;
+    int64_t TotalReadCount;
+    int64_t ContigCount;
+    uint32_t Flags;
+    int32_t Resolution;
+    // file offsets of the index, the summary table and the data section
+    uint64_t Index;
+    uint64_t Summaries;
+    uint64_t Data;
+    uint64_t DataSize;
+};
+
+struct ReadCoverageIndexEntry
+{
+    // offset of the encoded positions inside the data section
+    uint64_t Offset;
+    uint64_t Size;
+    int64_t Count;
+};
+
+struct ReadCoverageSummaryEntry
+{
+    int64_t Length;
+    int64_t Starts;
+    int64_t Contained;
+    int64_t Bases;
+};
+
+#endif
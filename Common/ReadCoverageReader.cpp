@@ -28,11 +28,31 @@
 #include "ReadCoverageReader.h"
 #include "Helpers.h"
 #include <sstream>
+#include <cstring>
+#include <climits>
+#include <iostream>
 
 using namespace std;
 
+namespace
+{
+    bool getVarint(const unsigned char *&p, const unsigned char *end, uint32_t &value)
+    {
+        value = 0;
+        for (int shift = 0; shift < 35 && p < end; shift += 7)
+        {
+            unsigned char byte = *p++;
+            value |= (uint32_t)(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0)
+                return true;
+        }
+        return false;
+    }
+}
+
 ReadCoverageReader::ReadCoverageReader()
 {
+    format = TextReadCoverage;
 }
 
 ReadCoverageReader::~ReadCoverageReader()
@@ -43,8 +63,24 @@ ReadCoverageReader::~ReadCoverageReader()
 
 bool ReadCoverageReader::Open(const string &fileName)
 {
-    if (in.is_open())
+    if (in.is_open() || file.IsOpen())
+        return false;
+    if (!file.Open(fileName))
         return false;
+
+    // binary files are recognised by their magic number
+    if (file.Size() >= sizeof(ReadCoverageMagic) && memcmp(file.Data(), ReadCoverageMagic, sizeof(ReadCoverageMagic)) == 0)
+    {
+        format = BinaryReadCoverage;
+        if (!validBinary())
+        {
+            file.Close();
+            return false;
+        }
+        return true;
+    }
+    format = TextReadCoverage;
+    file.Close();
     in.open(fileName.c_str(), ios::in);
     return in.is_open();
 }
@@ -52,15 +88,18 @@ bool ReadCoverageReader::Open(const string &fileName)
 bool ReadCoverageReader::Close()
 {
     in.close();
+    file.Close();
     return true;
 }
 
 bool ReadCoverageReader::Read(ReadCoverage &coverage)
 {
     int nContigs;
+    if (format == BinaryReadCoverage && file.IsOpen())
+        return readBinary(coverage);
     if (!in.is_open())
         return false;
-    coverage.SetContigCount(0);
+    coverage = ReadCoverage();
     if (!readHeader(nContigs, coverage))
         return false;
     if (!readContigs(nContigs, coverage))
@@ -82,10 +121,29 @@ bool ReadCoverageReader::readHeader(int &nContigs, ReadCoverage &coverage)
     long long totalReadLength = Helpers::GetArgument<long long>(totalReadLengthStr);
     int nReads = Helpers::GetArgument<int>(nReadsStr);
     nContigs = Helpers::GetArgument<int>(nContigsStr);
-    if (averageReadLength <= 0 || totalReadLength < 0 || nReads <= 0 || nContigs < 0)
+    // coverage without any reads is valid, just like in the binary format
+    bool noReads = nReads == 0 && totalReadLength == 0 && averageReadLength == 0;
+    if (!noReads && (averageReadLength <= 0 || totalReadLength < 0 || nReads <= 0))
+        return false;
+    if (nContigs < 0)
         return false;
     
-    coverage.SetContigCount(nContigs);
+    // summarized coverage is marked by two more entries holding the histogram resolution
+    string summaryStr = Helpers::NextEntry(line);
+    if (summaryStr == "summary")
+    {
+        string resolutionStr = Helpers::NextEntry(line);
+        if (resolutionStr.length() == 0)
+            return false;
+        int resolution = Helpers::GetArgument<int>(resolutionStr);
+        if (resolution < 0)
+            return false;
+        // contig lengths and histograms are filled in per contig
+        coverage.Summarize(vector<int>(nContigs, 0));
+        coverage.Resolution = resolution;
+    }
+    else
+        coverage.SetContigCount(nContigs);
     coverage.SetAverageReadLength(totalReadLength, nReads);
     
     return true;
@@ -94,7 +152,7 @@ bool ReadCoverageReader::readHeader(int &nContigs, ReadCoverage &coverage)
 bool ReadCoverageReader::readContigs(int nContigs, ReadCoverage &coverage)
 {
     for (int i = 0; i < nContigs; i++)
-        if (!readContig(coverage))
+        if (!(coverage.Summarized ? readSummary(coverage) : readContig(coverage)))
             return false;
     return true;
 }
@@ -124,3 +182,152 @@ bool ReadCoverageReader::readContig(ReadCoverage &coverage)
     }
     return true;
 }
+
+bool ReadCoverageReader::readSummary(ReadCoverage &coverage)
+{
+    string line;
+    getline(in, line);
+    string contigIdStr = Helpers::NextEntry(line);
+    string lengthStr = Helpers::NextEntry(line);
+    string startsStr = Helpers::NextEntry(line);
+    string containedStr = Helpers::NextEntry(line);
+    string basesStr = Helpers::NextEntry(line);
+    string nBinsStr = Helpers::NextEntry(line);
+    if (nBinsStr.length() == 0)
+        return false;
+    int contigID = Helpers::GetArgument<int>(contigIdStr);
+    int nBins = Helpers::GetArgument<int>(nBinsStr);
+    if (contigID < 0 || contigID >= coverage.GetContigCount() || nBins < 0)
+        return false;
+
+    ReadCoverageSummary &summary = coverage.Summaries[contigID];
+    summary.Length = Helpers::GetArgument<int>(lengthStr);
+    summary.Starts = Helpers::GetArgument<long long>(startsStr);
+    summary.Contained = Helpers::GetArgument<long long>(containedStr);
+    summary.Bases = Helpers::GetArgument<long long>(basesStr);
+    summary.Histogram.assign(nBins, 0);
+    if (nBins > 0)
+    {
+        getline(in, line);
+        stringstream ss(line);
+        for (int j = 0; j < nBins; j++)
+            if (!(ss >> summary.Histogram[j]))
+                return false;
+    }
+    return true;
+}
+
+bool ReadCoverageReader::IsSummarized() const
+{
+    return format == BinaryReadCoverage && file.IsOpen() && (header().Flags & ReadCoverageSummarized) != 0;
+}
+
+int ReadCoverageReader::GetContigCount() const
+{
+    if (format != BinaryReadCoverage || !file.IsOpen())
+        return -1;
+    return header().ContigCount;
+}
+
+bool ReadCoverageReader::ReadContig(int id, vector<int> &positions) const
+{
+    positions.clear();
+    if (id < 0 || id >= GetContigCount() || IsSummarized())
+        return false;
+    const ReadCoverageHeader &h = header();
+    const ReadCoverageIndexEntry &entry = ((const ReadCoverageIndexEntry *)(file.Data() + h.Index))[id];
+    const unsigned char *p = (const unsigned char *)file.Data() + h.Data + entry.Offset;
+    const unsigned char *end = p + entry.Size;
+
+    positions.reserve(entry.Count);
+    uint32_t value;
+    int position = 0;
+    for (int64_t i = 0; i < entry.Count; i++)
+    {
+        if (!getVarint(p, end, value))
+            return false;
+        if (i == 0)
+            position = (int)(value >> 1) ^ -(int)(value & 1);
+        else
+            position = (int)((uint32_t)position + value);
+        positions.push_back(position);
+    }
+    return p == end;
+}
+
+bool ReadCoverageReader::ReadSummary(int id, ReadCoverageSummary &summary) const
+{
+    if (id < 0 || id >= GetContigCount() || !IsSummarized())
+        return false;
+    const ReadCoverageHeader &h = header();
+    const ReadCoverageIndexEntry &entry = ((const ReadCoverageIndexEntry *)(file.Data() + h.Index))[id];
+    const ReadCoverageSummaryEntry &stored = ((const ReadCoverageSummaryEntry *)(file.Data() + h.Summaries))[id];
+    summary.Length = stored.Length;
+    summary.Starts = stored.Starts;
+    summary.Contained = stored.Contained;
+    summary.Bases = stored.Bases;
+
+    const unsigned char *p = (const unsigned char *)file.Data() + h.Data + entry.Offset;
+    const unsigned char *end = p + entry.Size;
+    summary.Histogram.resize(entry.Count);
+    uint32_t value;
+    for (int64_t i = 0; i < entry.Count; i++)
+    {
+        if (!getVarint(p, end, value))
+            return false;
+        summary.Histogram[i] = value;
+    }
+    return p == end;
+}
+
+bool ReadCoverageReader::readBinary(ReadCoverage &coverage)
+{
+    const ReadCoverageHeader &h = header();
+    // coverage without any reads is valid, reads without length are not
+    if (h.TotalReadCount < 0 || h.TotalReadCount > INT_MAX || h.TotalReadLength < 0 || (h.TotalReadCount == 0 && h.TotalReadLength != 0))
+        return false;
+    int nContigs = h.ContigCount;
+    coverage = ReadCoverage();
+    if (IsSummarized())
+    {
+        coverage.Summarize(vector<int>(nContigs, 0));
+        coverage.Resolution = h.Resolution;
+    }
+    else
+        coverage.SetContigCount(nContigs);
+    coverage.SetAverageReadLength(h.TotalReadLength, h.TotalReadCount);
+    for (int i = 0; i < nContigs; i++)
+        if (!(coverage.Summarized ? ReadSummary(i, coverage.Summaries[i]) : ReadContig(i, coverage.ReadLocations[i])))
+            return false;
+    return true;
+}
+
+// checks that the index and the data it points to lie within the file
+bool ReadCoverageReader::validBinary() const
+{
+    size_t size = file.Size();
+    // magic and version lead the header in every version
+    if (size < sizeof(ReadCoverageMagic) + sizeof(uint32_t))
+        return false;
+    const ReadCoverageHeader &h = header();
+    if (h.Version != ReadCoverageVersion)
+    {
+        cerr << "[-] Unsupported read coverage file version " << h.Version << " (expected " << ReadCoverageVersion << ")." << endl;
+        return false;
+    }
+    if (size < sizeof(ReadCoverageHeader))
+        return false;
+    if (h.ByteOrder != ReadCoverageByteOrder || h.ContigCount < 0 || h.ContigCount > INT_MAX)
+        return false;
+    if (h.Index % 8 != 0 || h.Index > size || (uint64_t)h.ContigCount > (size - h.Index) / sizeof(ReadCoverageIndexEntry))
+        return false;
+    if (h.Data > size || h.DataSize > size - h.Data)
+        return false;
+    if ((h.Flags & ReadCoverageSummarized) != 0 && (h.Resolution < 0 || h.Summaries % 8 != 0 || h.Summaries > size || (uint64_t)h.ContigCount > (size - h.Summaries) / sizeof(ReadCoverageSummaryEntry)))
+        return false;
+    const ReadCoverageIndexEntry *index = (const ReadCoverageIndexEntry *)(file.Data() + h.Index);
+    for (int64_t i = 0; i < h.ContigCount; i++)
+        if (index[i].Offset > h.DataSize || index[i].Size > h.DataSize - index[i].Offset || index[i].Count < 0 || (uint64_t)index[i].Count > index[i].Size)
+            return false;
+    return true;
+}
@@ -32,7 +32,10 @@
 #include <cstddef>
 #include <string>
 #include <fstream>
+#include <vector>
 #include "ReadCoverage.h"
+#include "ReadCoverageFormat.h"
+#include "MappedReader.h"
 
 using namespace std;
 
@@ -46,13 +49,28 @@ public:
     bool Open(const string &fileName);
     bool Close();
     bool Read(ReadCoverage &store);
+    ReadCoverageFileFormat GetFormat() const { return format; }
+    // number of contigs in a binary file, -1 for text files
+    int GetContigCount() const;
+    // decodes the read positions of a single contig of a binary file
+    bool ReadContig(int id, vector<int> &positions) const;
+    // decodes the summary of a single contig of a summarized binary file
+    bool ReadSummary(int id, ReadCoverageSummary &summary) const;
+    bool IsSummarized() const;
 
 private:
     bool readHeader(int &nContigs, ReadCoverage &coverage);
     bool readContigs(int nContigs, ReadCoverage &coverage);
     bool readContig(ReadCoverage &coverage);
+    bool readSummary(ReadCoverage &coverage);
+    bool readBinary(ReadCoverage &coverage);
+    bool validBinary() const;
+    const ReadCoverageHeader &header() const { return *(const ReadCoverageHeader *)file.Data(); }
         
 protected:
     fstream in;
+    // binary files are mapped instead of being read through the stream
+    MappedFile file;
+    ReadCoverageFileFormat format;
 };
 #endif
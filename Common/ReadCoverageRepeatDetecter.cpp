@@ -42,21 +42,16 @@ vector<int> ReadCoverageRepeatDetecter::Detect(double expectedCoverage, const Re
     for (int i = 0; i < nContigs; i++)
     {
         double observedMean = 0.0;
-        int contigLength = store[i].Sequence.Nucleotides.length();
-        vector<int> readPositions(coverage.ReadLocations[i]);
-        sort(readPositions.begin(), readPositions.end());
-        vector<int>::const_iterator pos = readPositions.begin();
-        while (pos != readPositions.end())
+        int contigLength = store[i].Sequence.Nucleotides.Length();
+        // summaries already hold the number of reads lying within the contig
+        if (coverage.Summarized)
+            observedMean = coverage.Summaries[i].Contained;
+        else
         {
-            vector<int>::const_iterator start = pos++;
-            int count = 1;
-            while (pos != readPositions.end() && *pos == *start)
-                count++, pos++;
-            if (*start >= 0)
-            {
-                if (*start <= contigLength - coverage.AverageReadLength)
-                    observedMean += count;
-            }
+            const vector<int> &readPositions = coverage.ReadLocations[i];
+            for (vector<int>::const_iterator pos = readPositions.begin(); pos != readPositions.end(); pos++)
+                if (*pos >= 0 && *pos <= contigLength - coverage.AverageReadLength)
+                    observedMean++;
         }
         contigLength -= (int)coverage.AverageReadLength;
         if (contigLength <= 0)
@@ -34,10 +34,26 @@
 
 #include "ReadCoverageWriter.h"
 #include <cstdio>
+#include <cstring>
+#include <algorithm>
 
-ReadCoverageWriter::ReadCoverageWriter()
+namespace
+{
+    void putVarint(uint32_t value, vector<unsigned char> &data)
+    {
+        while (value >= 0x80)
+        {
+            data.push_back((value & 0x7f) | 0x80);
+            value >>= 7;
+        }
+        data.push_back(value);
+    }
+}
+
+ReadCoverageWriter::ReadCoverageWriter(ReadCoverageFileFormat format)
 {
     out = NULL;
+    Format = format;
 }
 
 ReadCoverageWriter::~ReadCoverageWriter()
@@ -68,6 +84,15 @@ bool ReadCoverageWriter::Write(const ReadCoverage &coverage)
 {
     if (out == NULL)
         return false;
+    if (Format == BinaryReadCoverage)
+        return writeBinary(coverage);
+    return writeText(coverage);
+}
+
+bool ReadCoverageWriter::writeText(const ReadCoverage &coverage)
+{
+    if (coverage.Summarized)
+        return writeTextSummaries(coverage);
     int contigCount = coverage.GetContigCount();
     fprintf(out, "%.10lf\t%lld\t%i\t%i\n", coverage.AverageReadLength, coverage.TotalReadLength, coverage.TotalReadCount, contigCount);
     for (int i = 0; i < contigCount; i++)
@@ -79,3 +104,92 @@ bool ReadCoverageWriter::Write(const ReadCoverage &coverage)
     }
     return true;
 }
+
+// the header is marked with the histogram resolution, every contig line holds the contig's summary
+bool ReadCoverageWriter::writeTextSummaries(const ReadCoverage &coverage)
+{
+    int contigCount = coverage.GetContigCount();
+    fprintf(out, "%.10lf\t%lld\t%i\t%i\tsummary\t%i\n", coverage.AverageReadLength, coverage.TotalReadLength, coverage.TotalReadCount, contigCount, coverage.Resolution);
+    for (int i = 0; i < contigCount; i++)
+    {
+        const ReadCoverageSummary &summary = coverage.Summaries[i];
+        int binCount = (int)summary.Histogram.size();
+        fprintf(out, "%i\t%i\t%lld\t%lld\t%lld\t%i\n", i, summary.Length, summary.Starts, summary.Contained, summary.Bases, binCount);
+        for (int j = 0; j < binCount; j++)
+            fprintf(out, (j < binCount - 1 ? "%i\t" : "%i\n"), summary.Histogram[j]);
+    }
+    return true;
+}
+
+bool ReadCoverageWriter::writeBinary(const ReadCoverage &coverage)
+{
+    int contigCount = coverage.GetContigCount();
+    ReadCoverageHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.Magic, ReadCoverageMagic, sizeof(header.Magic));
+    header.Version = ReadCoverageVersion;
+    header.ByteOrder = ReadCoverageByteOrder;
+    header.AverageReadLength = coverage.AverageReadLength;
+    header.TotalReadLength = coverage.TotalReadLength;
+    header.TotalReadCount = coverage.TotalReadCount;
+    header.ContigCount = contigCount;
+    header.Flags = coverage.Summarized ? ReadCoverageSummarized : 0;
+    header.Resolution = coverage.Resolution;
+
+    vector<ReadCoverageIndexEntry> index(contigCount);
+    vector<ReadCoverageSummaryEntry> summaries(coverage.Summarized ? contigCount : 0);
+    vector<unsigned char> data;
+    for (int i = 0; i < contigCount; i++)
+    {
+        index[i].Offset = data.size();
+        if (coverage.Summarized)
+        {
+            const ReadCoverageSummary &summary = coverage.Summaries[i];
+            summaries[i].Length = summary.Length;
+            summaries[i].Starts = summary.Starts;
+            summaries[i].Contained = summary.Contained;
+            summaries[i].Bases = summary.Bases;
+            index[i].Count = summary.Histogram.size();
+            encodeHistogram(summary.Histogram, data);
+        }
+        else
+        {
+            index[i].Count = coverage.ReadLocations[i].size();
+            encodeContig(coverage.ReadLocations[i], data);
+        }
+        index[i].Size = data.size() - index[i].Offset;
+    }
+    header.Index = sizeof(header);
+    header.Summaries = header.Index + contigCount * sizeof(ReadCoverageIndexEntry);
+    header.Data = header.Summaries + summaries.size() * sizeof(ReadCoverageSummaryEntry);
+    header.DataSize = data.size();
+
+    if (fwrite(&header, sizeof(header), 1, out) != 1)
+        return false;
+    if (contigCount > 0 && fwrite(&index[0], sizeof(ReadCoverageIndexEntry), contigCount, out) != (size_t)contigCount)
+        return false;
+    if (!summaries.empty() && fwrite(&summaries[0], sizeof(ReadCoverageSummaryEntry), summaries.size(), out) != summaries.size())
+        return false;
+    if (!data.empty() && fwrite(&data[0], 1, data.size(), out) != data.size())
+        return false;
+    return true;
+}
+
+// positions are sorted, the first one is zigzag encoded to allow negative positions,
+// the rest are stored as (non-negative) differences to the previous position
+void ReadCoverageWriter::encodeContig(const vector<int> &locations, vector<unsigned char> &data)
+{
+    if (locations.empty())
+        return;
+    vector<int> sorted(locations);
+    sort(sorted.begin(), sorted.end());
+    putVarint(((uint32_t)sorted[0] << 1) ^ (uint32_t)(sorted[0] >> 31), data);
+    for (size_t i = 1; i < sorted.size(); i++)
+        putVarint((uint32_t)((int64_t)sorted[i] - sorted[i - 1]), data);
+}
+
+void ReadCoverageWriter::encodeHistogram(const vector<int> &histogram, vector<unsigned char> &data)
+{
+    for (size_t i = 0; i < histogram.size(); i++)
+        putVarint(histogram[i], data);
+}
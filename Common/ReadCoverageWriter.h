@@ -37,14 +37,17 @@
 #define	_READCOVERAGEWRITER_H
 
 #include <cstddef>
+#include <cstdio>
 #include <string>
+#include <vector>
 #include "ReadCoverage.h"
+#include "ReadCoverageFormat.h"
 
 using namespace std;
 
 class ReadCoverageWriter {
 public:
-    ReadCoverageWriter();
+    ReadCoverageWriter(ReadCoverageFileFormat format = TextReadCoverage);
     virtual ~ReadCoverageWriter();
 
 public:
@@ -52,6 +55,16 @@ public:
     bool Close();
     bool Write(const ReadCoverage &coverage);
 
+public:
+    ReadCoverageFileFormat Format;
+
+private:
+    bool writeText(const ReadCoverage &coverage);
+    bool writeBinary(const ReadCoverage &coverage);
+    bool writeTextSummaries(const ReadCoverage &coverage);
+    static void encodeContig(const vector<int> &locations, vector<unsigned char> &data);
+    static void encodeHistogram(const vector<int> &histogram, vector<unsigned char> &data);
+
 protected:
 	FILE *out;
 };
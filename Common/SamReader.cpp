@@ -0,0 +1,424 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+#include "SamReader.h"
+#include "SequenceKernels.h"
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace std;
+
+namespace
+{
+    // mandatory columns of a SAM record
+    const size_t MandatoryFields = 11;
+
+    template <class T>
+    inline void appendValue(string &data, T value)
+    {
+        data.append((const char *)&value, sizeof(T));
+    }
+
+    // samtools' choice of the narrowest integer type for an 'i' tag
+    void appendInteger(string &data, long long value)
+    {
+        if (value < 0)
+        {
+            if (value >= INT8_MIN)
+                data += 'c', appendValue<int8_t>(data, value);
+            else if (value >= INT16_MIN)
+                data += 's', appendValue<int16_t>(data, value);
+            else
+                data += 'i', appendValue<int32_t>(data, value);
+        }
+        else
+        {
+            if (value <= UINT8_MAX)
+                data += 'C', appendValue<uint8_t>(data, value);
+            else if (value <= UINT16_MAX)
+                data += 'S', appendValue<uint16_t>(data, value);
+            else
+                data += 'I', appendValue<uint32_t>(data, value);
+        }
+    }
+
+    // BAM bin of the 0-based half open interval [begin, end)
+    int regionToBin(int begin, int end)
+    {
+        --end;
+        if (begin >> 14 == end >> 14) return ((1 << 15) - 1) / 7 + (begin >> 14);
+        if (begin >> 17 == end >> 17) return ((1 << 12) - 1) / 7 + (begin >> 17);
+        if (begin >> 20 == end >> 20) return ((1 << 9) - 1) / 7 + (begin >> 20);
+        if (begin >> 23 == end >> 23) return ((1 << 6) - 1) / 7 + (begin >> 23);
+        if (begin >> 26 == end >> 26) return ((1 << 3) - 1) / 7 + (begin >> 26);
+        return 0;
+    }
+
+    inline bool isMissing(const char *field, size_t length)
+    {
+        return length == 1 && field[0] == '*';
+    }
+}
+
+SamReader::SamReader()
+    : fd(-1), ownsDescriptor(false), bufferPos(0), bufferEnd(0), endOfInput(false), hasPending(false), failed(false)
+{
+}
+
+SamReader::~SamReader()
+{
+    Close();
+}
+
+bool SamReader::Open(const string &fileName)
+{
+    if (IsOpen())
+        return false;
+    int descriptor = open(fileName.c_str(), O_RDONLY);
+    if (descriptor < 0)
+        return false;
+    if (!Open(descriptor))
+    {
+        close(descriptor);
+        return false;
+    }
+    ownsDescriptor = true;
+    return true;
+}
+
+bool SamReader::Open(int descriptor)
+{
+    if (IsOpen() || descriptor < 0)
+        return false;
+    fd = descriptor;
+    ownsDescriptor = false;
+    buffer.resize(BufferSize);
+    bufferPos = bufferEnd = 0;
+    endOfInput = hasPending = failed = false;
+    if (!readHeader())
+    {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+bool SamReader::Close()
+{
+    if (!IsOpen())
+        return false;
+    if (ownsDescriptor)
+        close(fd);
+    fd = -1;
+    references.clear();
+    referenceIndex.Clear();
+    headerText.clear();
+    pending.clear();
+    hasPending = false;
+    return true;
+}
+
+bool SamReader::IsOpen() const
+{
+    return fd >= 0;
+}
+
+bool SamReader::Failed() const
+{
+    return failed;
+}
+
+bool SamReader::GetNextAlignment(BamAlignment &alg)
+{
+    if (!IsOpen() || failed)
+        return false;
+    if (hasPending)
+    {
+        hasPending = false;
+        if (parseRecord(&pending[0], pending.length(), alg))
+            return true;
+        failed = true;
+        return false;
+    }
+
+    char *line;
+    size_t length;
+    while (nextLine(line, length))
+    {
+        if (length == 0)
+            continue;
+        if (parseRecord(line, length, alg))
+            return true;
+        failed = true;
+        return false;
+    }
+    return false;
+}
+
+const RefVector &SamReader::GetReferenceData() const
+{
+    return references;
+}
+
+int SamReader::GetReferenceCount() const
+{
+    return references.size();
+}
+
+const string &SamReader::GetHeaderText() const
+{
+    return headerText;
+}
+
+// Reads the @ lines up to the first record, which is kept for GetNextAlignment.
+bool SamReader::readHeader()
+{
+    char *line;
+    size_t length;
+    vector<string> names;
+    while (nextLine(line, length))
+    {
+        if (length == 0)
+            continue;
+        if (line[0] != '@')
+        {
+            pending.assign(line, length);
+            hasPending = true;
+            break;
+        }
+        headerText.append(line, length);
+        headerText += '\n';
+        if (length < 3 || strncmp(line, "@SQ", 3) != 0)
+            continue;
+
+        string name;
+        int32_t referenceLength = 0;
+        for (char *field = strchr(line, '\t'); field; field = strchr(field, '\t'))
+        {
+            field++;
+            size_t fieldLength = strcspn(field, "\t");
+            if (strncmp(field, "SN:", 3) == 0)
+                name.assign(field + 3, fieldLength - 3);
+            else if (strncmp(field, "LN:", 3) == 0)
+                referenceLength = strtol(field + 3, NULL, 10);
+        }
+        if (name.empty())
+            return false;
+        references.push_back(RefData(name, referenceLength));
+        names.push_back(name);
+    }
+    referenceIndex.Assign(names);
+    return true;
+}
+
+// Returns the next line (without its terminator and NUL terminated in place),
+// valid until the following call. Lines longer than the buffer grow it.
+bool SamReader::nextLine(char *&line, size_t &length)
+{
+    while (true)
+    {
+        char *start = &buffer[bufferPos];
+        char *newline = (char *)memchr(start, '\n', bufferEnd - bufferPos);
+        if (newline || (endOfInput && bufferPos < bufferEnd))
+        {
+            // there is always a spare byte past bufferEnd for the terminator
+            char *end = (newline ? newline : &buffer[bufferEnd]);
+            bufferPos = (newline ? newline + 1 - &buffer[0] : bufferEnd);
+            if (end > start && end[-1] == '\r')
+                end--;
+            *end = 0;
+            line = start;
+            length = end - start;
+            return true;
+        }
+        if (endOfInput)
+            return false;
+
+        // keep the partial line and refill behind it
+        size_t remaining = bufferEnd - bufferPos;
+        memmove(&buffer[0], &buffer[bufferPos], remaining);
+        bufferPos = 0;
+        bufferEnd = remaining;
+        if (bufferEnd + 1 == buffer.size())
+            buffer.resize(2 * buffer.size());
+        ssize_t count = read(fd, &buffer[bufferEnd], buffer.size() - bufferEnd - 1);
+        if (count < 0 && errno == EINTR)
+            continue;
+        if (count <= 0)
+        {
+            if (count < 0)
+                failed = true;
+            endOfInput = true;
+        }
+        else
+            bufferEnd += count;
+    }
+}
+
+bool SamReader::parseRecord(char *line, size_t length, BamAlignment &alg)
+{
+    fields.clear();
+    fields.push_back(line);
+    for (char *pos = line, *end = line + length; (pos = (char *)memchr(pos, '\t', end - pos)); pos++)
+        fields.push_back(pos + 1);
+    if (fields.size() < MandatoryFields)
+        return false;
+    fields.push_back(line + length + 1);
+    // field i spans [fields[i], fields[i + 1] - 1)
+    auto size = [this](size_t i) { return (size_t)(fields[i + 1] - fields[i] - 1); };
+
+    alg.Name.assign(fields[0], size(0));
+    alg.AlignmentFlag = strtoul(fields[1], NULL, 10);
+    alg.RefID = (isMissing(fields[2], size(2)) ? -1 : findReference(fields[2], size(2)));
+    alg.Position = strtol(fields[3], NULL, 10) - 1;
+    alg.MapQuality = strtoul(fields[4], NULL, 10);
+
+    alg.CigarData.clear();
+    int end = alg.Position;
+    if (!isMissing(fields[5], size(5)))
+    {
+        const char *pos = fields[5], *cigarEnd = fields[5] + size(5);
+        while (pos < cigarEnd)
+        {
+            char *next;
+            CigarOp op;
+            op.Length = strtoul(pos, &next, 10);
+            if (next == pos || next >= cigarEnd || !strchr("MIDNSHP=X", *next))
+                return false;
+            op.Type = *next;
+            pos = next + 1;
+            alg.CigarData.push_back(op);
+            if (strchr("MDN=X", op.Type))
+                end += op.Length;
+        }
+    }
+    alg.Bin = regionToBin(alg.Position, end > alg.Position ? end : alg.Position + 1);
+
+    if (size(6) == 1 && fields[6][0] == '=')
+        alg.MateRefID = alg.RefID;
+    else
+        alg.MateRefID = (isMissing(fields[6], size(6)) ? -1 : findReference(fields[6], size(6)));
+    alg.MatePosition = strtol(fields[7], NULL, 10) - 1;
+    alg.InsertSize = strtol(fields[8], NULL, 10);
+
+    if (isMissing(fields[9], size(9)))
+        alg.QueryBases.clear();
+    else
+    {
+        alg.QueryBases.assign(fields[9], size(9));
+        SequenceKernels::ToUpper(alg.QueryBases);
+    }
+    alg.Length = alg.QueryBases.length();
+    if (isMissing(fields[10], size(10)))
+        alg.Qualities.assign(alg.Length, (char)0xff);
+    else
+        alg.Qualities.assign(fields[10], size(10));
+    if ((int)alg.Qualities.length() != alg.Length)
+        return false;
+
+    alg.TagData.clear();
+    for (size_t i = MandatoryFields; i + 1 < fields.size(); i++)
+    {
+        if (!parseTag(fields[i], size(i), alg.TagData))
+            return false;
+    }
+    alg.AlignedBases.clear();
+    return true;
+}
+
+// Appends a TAG:TYPE:VALUE field in the binary BAM layout.
+bool SamReader::parseTag(const char *field, size_t length, string &data)
+{
+    if (length < 5 || field[2] != ':' || field[4] != ':')
+        return false;
+    const char *value = field + 5, *end = field + length;
+    data.append(field, 2);
+    switch (field[3])
+    {
+    case 'A':
+        if (end - value != 1)
+            return false;
+        data += 'A';
+        data += *value;
+        return true;
+    case 'i':
+        appendInteger(data, strtoll(value, NULL, 10));
+        return true;
+    case 'f':
+        data += 'f';
+        appendValue<float>(data, strtof(value, NULL));
+        return true;
+    case 'Z':
+    case 'H':
+        data += field[3];
+        data.append(value, end - value);
+        data += '\0';
+        return true;
+    case 'B':
+    {
+        if (value == end)
+            return false;
+        char type = *value;
+        data += 'B';
+        data += type;
+        size_t countPos = data.length();
+        appendValue<int32_t>(data, 0);
+        int32_t count = 0;
+        for (const char *pos = value + 1; pos < end && *pos == ','; count++)
+        {
+            char *next;
+            pos++;
+            switch (type)
+            {
+            case 'c': appendValue<int8_t>(data, strtol(pos, &next, 10)); break;
+            case 'C': appendValue<uint8_t>(data, strtoul(pos, &next, 10)); break;
+            case 's': appendValue<int16_t>(data, strtol(pos, &next, 10)); break;
+            case 'S': appendValue<uint16_t>(data, strtoul(pos, &next, 10)); break;
+            case 'i': appendValue<int32_t>(data, strtol(pos, &next, 10)); break;
+            case 'I': appendValue<uint32_t>(data, strtoul(pos, &next, 10)); break;
+            case 'f': appendValue<float>(data, strtof(pos, &next)); break;
+            default: return false;
+            }
+            pos = next;
+        }
+        memcpy(&data[countPos], &count, sizeof(count));
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+// References missing from the header are treated as unmapped, as samtools does.
+int SamReader::findReference(const char *name, size_t length) const
+{
+    return referenceIndex.Find(name, length);
+}
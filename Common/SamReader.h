@@ -0,0 +1,90 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+/*
+ * SAM text input decoded into BamAlignment objects, so aligner output can be
+ * consumed straight from a pipe instead of being converted to BAM first. The
+ * records carry the same fields BamFileReader fills: 0-based positions,
+ * reference ids resolved against the @SQ header lines, ASCII qualities and
+ * TagData re-encoded in the binary BAM layout so GetTag and AlignmentTags work.
+ */
+
+#ifndef _SAMREADER_H
+#define _SAMREADER_H
+
+#include "api/BamAlignment.h"
+#include "NameIndex.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace BamTools;
+
+class SamReader
+{
+public:
+    SamReader();
+    ~SamReader();
+
+public:
+    bool Open(const string &fileName);
+    // reads from a descriptor owned by the caller, e.g. the read end of a pipe
+    bool Open(int descriptor);
+    bool Close();
+    bool IsOpen() const;
+    bool Failed() const;
+    bool GetNextAlignment(BamAlignment &alg);
+    const RefVector &GetReferenceData() const;
+    int GetReferenceCount() const;
+    const string &GetHeaderText() const;
+
+private:
+    bool readHeader();
+    bool nextLine(char *&line, size_t &length);
+    bool parseRecord(char *line, size_t length, BamAlignment &alg);
+    bool parseTag(const char *field, size_t length, string &data);
+    int findReference(const char *name, size_t length) const;
+
+private:
+    static const size_t BufferSize = 1 << 20;
+
+    int fd;
+    bool ownsDescriptor;
+    vector<char> buffer;
+    size_t bufferPos, bufferEnd;
+    bool endOfInput;
+    string pending;
+    bool hasPending;
+    RefVector references;
+    NameIndex referenceIndex;
+    string headerText;
+    vector<const char *> fields;
+    bool failed;
+};
+
+#endif
@@ -0,0 +1,256 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+#include "ScratchSpace.h"
+#include "Helpers.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <climits>
+#include <map>
+#include <vector>
+#include <mutex>
+#include <signal.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+using namespace std;
+
+namespace
+{
+    const int MaxDirectories = 32;
+    const int FatalSignals[] = { SIGINT, SIGTERM, SIGHUP, SIGQUIT, SIGSEGV, SIGBUS, SIGABRT, SIGFPE, SIGILL };
+
+    mutex scratchLock;
+    long long memoryBudget = 0;
+    string memoryPath = "/dev/shm";
+    string memoryDirectory;
+    bool memoryDirectoryFailed = false;
+    map<string, string> diskDirectories;
+    map<string, int> memoryFiles;
+    long long counter = 0;
+    bool handlersInstalled = false;
+
+    // plain arrays, so the signal handler does not walk containers that may be mid-update
+    char directories[MaxDirectories][PATH_MAX];
+    volatile sig_atomic_t directoryCount = 0;
+
+    void removeDirectory(const char *path)
+    {
+        DIR *dir = opendir(path);
+        if (dir)
+        {
+            char name[PATH_MAX];
+            struct dirent *item;
+            while ((item = readdir(dir)))
+            {
+                if (strcmp(item->d_name, ".") == 0 || strcmp(item->d_name, "..") == 0)
+                    continue;
+                snprintf(name, sizeof(name), "%s/%s", path, item->d_name);
+                unlink(name);
+            }
+            closedir(dir);
+        }
+        rmdir(path);
+    }
+
+    void removeDirectories()
+    {
+        for (int i = 0; i < directoryCount; i++)
+            removeDirectory(directories[i]);
+        directoryCount = 0;
+    }
+
+    // Best effort: opendir is not async-signal-safe, but a crashing process has little to lose.
+    void handleFatalSignal(int signal)
+    {
+        removeDirectories();
+        raise(signal);
+    }
+
+    void installHandlers()
+    {
+        if (handlersInstalled)
+            return;
+        handlersInstalled = true;
+        atexit(removeDirectories);
+        for (size_t i = 0; i < sizeof(FatalSignals) / sizeof(FatalSignals[0]); i++)
+        {
+            struct sigaction current;
+            // leave handlers someone else installed alone
+            if (sigaction(FatalSignals[i], NULL, &current) != 0 || current.sa_handler != SIG_DFL)
+                continue;
+            struct sigaction action;
+            memset(&action, 0, sizeof(action));
+            action.sa_handler = handleFatalSignal;
+            action.sa_flags = SA_RESETHAND;
+            sigemptyset(&action.sa_mask);
+            sigaction(FatalSignals[i], &action, NULL);
+        }
+    }
+
+    // Creates a private directory under path, empty on failure.
+    string createDirectory(const string &path)
+    {
+        if (directoryCount >= MaxDirectories)
+            return "";
+        string pattern = (path.empty() ? string(".") : path) + "/" + Helpers::TempFilePrefix + "XXXXXX";
+        vector<char> name(pattern.begin(), pattern.end());
+        name.push_back(0);
+        if (!mkdtemp(&name[0]) || strlen(&name[0]) >= PATH_MAX)
+            return "";
+        installHandlers();
+        strcpy(directories[directoryCount], &name[0]);
+        directoryCount = directoryCount + 1;
+        return &name[0];
+    }
+
+    long long directorySize(const string &path)
+    {
+        long long size = 0;
+        DIR *dir = opendir(path.c_str());
+        if (!dir)
+            return 0;
+        struct dirent *item;
+        while ((item = readdir(dir)))
+        {
+            struct stat s;
+            if (stat((path + "/" + item->d_name).c_str(), &s) == 0 && S_ISREG(s.st_mode))
+                size += s.st_size;
+        }
+        closedir(dir);
+        return size;
+    }
+
+    // expects the lock to be held
+    long long memoryUsage()
+    {
+        long long usage = (memoryDirectory.empty() ? 0 : directorySize(memoryDirectory));
+        for (map<string, int>::const_iterator it = memoryFiles.begin(); it != memoryFiles.end(); it++)
+        {
+            struct stat s;
+            if (fstat(it->second, &s) == 0)
+                usage += s.st_size;
+        }
+        return usage;
+    }
+
+    string nextName(const string &directory)
+    {
+        char name[32];
+        sprintf(name, "/%lld", counter++);
+        return directory + name;
+    }
+
+    // Falls back to the temporary path itself when no private directory can be made there.
+    string diskName(const string &diskPath)
+    {
+        map<string, string>::iterator it = diskDirectories.find(diskPath);
+        if (it == diskDirectories.end())
+            it = diskDirectories.insert(make_pair(diskPath, createDirectory(diskPath))).first;
+        if (!it->second.empty())
+            return nextName(it->second);
+        char name[64];
+        sprintf(name, "%s%d.%lld", Helpers::TempFilePrefix.c_str(), (int)getpid(), counter++);
+        return (diskPath.empty() ? string("") : diskPath + "/") + name;
+    }
+}
+
+void ScratchSpace::SetMemoryBudget(long long bytes)
+{
+    lock_guard<mutex> guard(scratchLock);
+    memoryBudget = bytes;
+}
+
+void ScratchSpace::SetMemoryPath(const string &path)
+{
+    lock_guard<mutex> guard(scratchLock);
+    memoryPath = path;
+    memoryDirectory.clear();
+    memoryDirectoryFailed = false;
+}
+
+long long ScratchSpace::GetMemoryUsage()
+{
+    lock_guard<mutex> guard(scratchLock);
+    return memoryUsage();
+}
+
+string ScratchSpace::CreateFile(const string &diskPath)
+{
+    lock_guard<mutex> guard(scratchLock);
+#ifdef MFD_CLOEXEC
+    if (memoryBudget > 0 && memoryUsage() < memoryBudget)
+    {
+        int fd = memfd_create("grass-scratch", MFD_CLOEXEC);
+        if (fd >= 0)
+        {
+            char name[64];
+            sprintf(name, "/proc/%d/fd/%d", (int)getpid(), fd);
+            memoryFiles[name] = fd;
+            return name;
+        }
+    }
+#endif
+    return diskName(diskPath);
+}
+
+string ScratchSpace::CreatePrefix(const string &diskPath)
+{
+    lock_guard<mutex> guard(scratchLock);
+    if (memoryBudget > 0 && !memoryDirectoryFailed && memoryUsage() < memoryBudget)
+    {
+        if (memoryDirectory.empty())
+        {
+            memoryDirectory = createDirectory(memoryPath);
+            memoryDirectoryFailed = memoryDirectory.empty();
+        }
+        if (!memoryDirectory.empty())
+            return nextName(memoryDirectory);
+    }
+    return diskName(diskPath);
+}
+
+bool ScratchSpace::Remove(const string &path)
+{
+    lock_guard<mutex> guard(scratchLock);
+    map<string, int>::iterator it = memoryFiles.find(path);
+    if (it == memoryFiles.end())
+        return false;
+    close(it->second);
+    memoryFiles.erase(it);
+    return true;
+}
+
+bool ScratchSpace::IsInMemory(const string &path)
+{
+    lock_guard<mutex> guard(scratchLock);
+    return memoryFiles.count(path) > 0 || (!memoryDirectory.empty() && path.compare(0, memoryDirectory.length() + 1, memoryDirectory + "/") == 0);
+}
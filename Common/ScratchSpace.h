@@ -0,0 +1,64 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+/*
+ * Scratch files handed between GRASS and external tools. Single output files
+ * are backed by memfd_create while the memory budget allows and are passed
+ * around as /proc/<pid>/fd/<n> paths, which children can open like any other
+ * file. Path prefixes (tools that derive several file names, such as bwa index
+ * or nucmer) go to a per-process directory on tmpfs under the same budget.
+ * Everything else lands in a per-process directory under the tool's temporary
+ * path. Names come from a counter, so no probing for free names is needed.
+ * Memory backed files vanish with the process; the directories are removed at
+ * exit and, on a best effort basis, when the process dies from a fatal signal.
+ */
+
+#ifndef _SCRATCHSPACE_H
+#define _SCRATCHSPACE_H
+
+#include <string>
+
+using namespace std;
+
+namespace ScratchSpace
+{
+    // bytes of memory backed scratch admitted at once, 0 keeps everything on disk
+    void SetMemoryBudget(long long bytes);
+    // tmpfs directory used for memory backed prefixes
+    void SetMemoryPath(const string &path);
+    long long GetMemoryUsage();
+
+    // A fresh file name for a tool to write; memory backed while the budget allows.
+    string CreateFile(const string &diskPath);
+    // A fresh name prefix, the tool creates files named prefix + suffix.
+    string CreatePrefix(const string &diskPath);
+    // Drops a memory backed file, false if the path is not one.
+    bool Remove(const string &path);
+    bool IsInMemory(const string &path);
+}
+
+#endif
@@ -0,0 +1,385 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+#include "SequenceKernels.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define _SEQUENCEKERNELS_X86
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+namespace
+{
+    enum InstructionLevel { ScalarLevel, SSE41Level, AVX2Level };
+
+    InstructionLevel detectLevel()
+    {
+#ifdef _SEQUENCEKERNELS_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2"))
+            return AVX2Level;
+        if (__builtin_cpu_supports("sse4.1"))
+            return SSE41Level;
+#endif
+        return ScalarLevel;
+    }
+
+    InstructionLevel level()
+    {
+        static const InstructionLevel detected = detectLevel();
+        return detected;
+    }
+
+    struct ComplementTable
+    {
+        ComplementTable()
+        {
+            for (int i = 0; i < 256; i++)
+                Table[i] = 'N';
+            const char *from = "ACGTacgtNn*", *to = "TGCAtgcaNn*";
+            for (int i = 0; from[i]; i++)
+                Table[(unsigned char)from[i]] = to[i];
+        }
+
+        char Table[256];
+    };
+
+    const ComplementTable complementTable;
+
+    inline char complement(char c)
+    {
+        return complementTable.Table[(unsigned char)c];
+    }
+
+    void complementScalar(char *data, size_t length)
+    {
+        for (size_t i = 0; i < length; i++)
+            data[i] = complement(data[i]);
+    }
+
+    void reverseComplementScalar(char *data, size_t length)
+    {
+        if (length == 0)
+            return;
+        for (size_t i = 0, j = length - 1; i < j; i++, j--)
+        {
+            char c = complement(data[i]);
+            data[i] = complement(data[j]);
+            data[j] = c;
+        }
+        if (length & 1)
+            data[length / 2] = complement(data[length / 2]);
+    }
+
+    void reverseComplementScalar(const char *source, size_t length, char *destination)
+    {
+        for (size_t i = 0; i < length; i++)
+            destination[i] = complement(source[length - 1 - i]);
+    }
+
+    void reverseScalar(char *data, size_t length)
+    {
+        if (length == 0)
+            return;
+        for (size_t i = 0, j = length - 1; i < j; i++, j--)
+        {
+            char c = data[i];
+            data[i] = data[j];
+            data[j] = c;
+        }
+    }
+
+    void toUpperScalar(char *data, size_t length)
+    {
+        for (size_t i = 0; i < length; i++)
+            if (data[i] >= 'a' && data[i] <= 'z')
+                data[i] -= 'a' - 'A';
+    }
+
+#ifdef _SEQUENCEKERNELS_X86
+    // The complement of an uppercase base is looked up by its low nibble. A byte is
+    // a valid base when the lookup hits and complementing the result gives the byte
+    // back; case is carried over through the 0x20 bit.
+    __attribute__((target("sse4.1"))) inline __m128i complement128(__m128i c)
+    {
+        const __m128i lut = _mm_setr_epi8(0, 'T', 0, 'G', 'A', 0, 0, 'C', 0, 0, 0, 0, 0, 0, 'N', 0);
+        const __m128i low = _mm_set1_epi8(0x0f), caseBit = _mm_set1_epi8(0x20);
+        __m128i letterCase = _mm_and_si128(c, caseBit);
+        __m128i v = _mm_shuffle_epi8(lut, _mm_and_si128(c, low));
+        __m128i back = _mm_or_si128(_mm_shuffle_epi8(lut, _mm_and_si128(v, low)), letterCase);
+        __m128i valid = _mm_andnot_si128(_mm_cmpeq_epi8(v, _mm_setzero_si128()), _mm_cmpeq_epi8(back, c));
+        __m128i other = _mm_blendv_epi8(_mm_set1_epi8('N'), c, _mm_cmpeq_epi8(c, _mm_set1_epi8('*')));
+        return _mm_blendv_epi8(other, _mm_or_si128(v, letterCase), valid);
+    }
+
+    __attribute__((target("sse4.1"))) inline __m128i reverse128(__m128i c)
+    {
+        return _mm_shuffle_epi8(c, _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0));
+    }
+
+    __attribute__((target("sse4.1"))) void complementSSE41(char *data, size_t length)
+    {
+        size_t i = 0;
+        for (; i + 16 <= length; i += 16)
+            _mm_storeu_si128((__m128i *)(data + i), complement128(_mm_loadu_si128((const __m128i *)(data + i))));
+        complementScalar(data + i, length - i);
+    }
+
+    __attribute__((target("sse4.1"))) void reverseComplementSSE41(char *data, size_t length)
+    {
+        size_t i = 0, j = length;
+        for (; j - i >= 32; i += 16, j -= 16)
+        {
+            __m128i front = _mm_loadu_si128((const __m128i *)(data + i));
+            __m128i back = _mm_loadu_si128((const __m128i *)(data + j - 16));
+            _mm_storeu_si128((__m128i *)(data + i), reverse128(complement128(back)));
+            _mm_storeu_si128((__m128i *)(data + j - 16), reverse128(complement128(front)));
+        }
+        reverseComplementScalar(data + i, j - i);
+    }
+
+    __attribute__((target("sse4.1"))) void reverseComplementSSE41(const char *source, size_t length, char *destination)
+    {
+        size_t i = 0;
+        for (; i + 16 <= length; i += 16)
+            _mm_storeu_si128((__m128i *)(destination + i), reverse128(complement128(_mm_loadu_si128((const __m128i *)(source + length - i - 16)))));
+        reverseComplementScalar(source, length - i, destination + i);
+    }
+
+    __attribute__((target("sse4.1"))) void reverseSSE41(char *data, size_t length)
+    {
+        size_t i = 0, j = length;
+        for (; j - i >= 32; i += 16, j -= 16)
+        {
+            __m128i front = _mm_loadu_si128((const __m128i *)(data + i));
+            __m128i back = _mm_loadu_si128((const __m128i *)(data + j - 16));
+            _mm_storeu_si128((__m128i *)(data + i), reverse128(back));
+            _mm_storeu_si128((__m128i *)(data + j - 16), reverse128(front));
+        }
+        reverseScalar(data + i, j - i);
+    }
+
+    __attribute__((target("sse4.1"))) void toUpperSSE41(char *data, size_t length)
+    {
+        size_t i = 0;
+        for (; i + 16 <= length; i += 16)
+        {
+            __m128i c = _mm_loadu_si128((const __m128i *)(data + i));
+            __m128i lower = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(c, _mm_set1_epi8('z' + 1)));
+            _mm_storeu_si128((__m128i *)(data + i), _mm_sub_epi8(c, _mm_and_si128(lower, _mm_set1_epi8(0x20))));
+        }
+        toUpperScalar(data + i, length - i);
+    }
+
+    __attribute__((target("avx2"))) inline __m256i complement256(__m256i c)
+    {
+        const __m256i lut = _mm256_setr_epi8(0, 'T', 0, 'G', 'A', 0, 0, 'C', 0, 0, 0, 0, 0, 0, 'N', 0,
+                                             0, 'T', 0, 'G', 'A', 0, 0, 'C', 0, 0, 0, 0, 0, 0, 'N', 0);
+        const __m256i low = _mm256_set1_epi8(0x0f), caseBit = _mm256_set1_epi8(0x20);
+        __m256i letterCase = _mm256_and_si256(c, caseBit);
+        __m256i v = _mm256_shuffle_epi8(lut, _mm256_and_si256(c, low));
+        __m256i back = _mm256_or_si256(_mm256_shuffle_epi8(lut, _mm256_and_si256(v, low)), letterCase);
+        __m256i valid = _mm256_andnot_si256(_mm256_cmpeq_epi8(v, _mm256_setzero_si256()), _mm256_cmpeq_epi8(back, c));
+        __m256i other = _mm256_blendv_epi8(_mm256_set1_epi8('N'), c, _mm256_cmpeq_epi8(c, _mm256_set1_epi8('*')));
+        return _mm256_blendv_epi8(other, _mm256_or_si256(v, letterCase), valid);
+    }
+
+    __attribute__((target("avx2"))) inline __m256i reverse256(__m256i c)
+    {
+        const __m256i order = _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+                                               15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+        return _mm256_permute4x64_epi64(_mm256_shuffle_epi8(c, order), 0x4e);
+    }
+
+    __attribute__((target("avx2"))) void complementAVX2(char *data, size_t length)
+    {
+        size_t i = 0;
+        for (; i + 32 <= length; i += 32)
+            _mm256_storeu_si256((__m256i *)(data + i), complement256(_mm256_loadu_si256((const __m256i *)(data + i))));
+        complementScalar(data + i, length - i);
+    }
+
+    __attribute__((target("avx2"))) void reverseComplementAVX2(char *data, size_t length)
+    {
+        size_t i = 0, j = length;
+        for (; j - i >= 64; i += 32, j -= 32)
+        {
+            __m256i front = _mm256_loadu_si256((const __m256i *)(data + i));
+            __m256i back = _mm256_loadu_si256((const __m256i *)(data + j - 32));
+            _mm256_storeu_si256((__m256i *)(data + i), reverse256(complement256(back)));
+            _mm256_storeu_si256((__m256i *)(data + j - 32), reverse256(complement256(front)));
+        }
+        reverseComplementScalar(data + i, j - i);
+    }
+
+    __attribute__((target("avx2"))) void reverseComplementAVX2(const char *source, size_t length, char *destination)
+    {
+        size_t i = 0;
+        for (; i + 32 <= length; i += 32)
+            _mm256_storeu_si256((__m256i *)(destination + i), reverse256(complement256(_mm256_loadu_si256((const __m256i *)(source + length - i - 32)))));
+        reverseComplementScalar(source, length - i, destination + i);
+    }
+
+    __attribute__((target("avx2"))) void reverseAVX2(char *data, size_t length)
+    {
+        size_t i = 0, j = length;
+        for (; j - i >= 64; i += 32, j -= 32)
+        {
+            __m256i front = _mm256_loadu_si256((const __m256i *)(data + i));
+            __m256i back = _mm256_loadu_si256((const __m256i *)(data + j - 32));
+            _mm256_storeu_si256((__m256i *)(data + i), reverse256(back));
+            _mm256_storeu_si256((__m256i *)(data + j - 32), reverse256(front));
+        }
+        reverseScalar(data + i, j - i);
+    }
+
+    __attribute__((target("avx2"))) void toUpperAVX2(char *data, size_t length)
+    {
+        size_t i = 0;
+        for (; i + 32 <= length; i += 32)
+        {
+            __m256i c = _mm256_loadu_si256((const __m256i *)(data + i));
+            __m256i lower = _mm256_and_si256(_mm256_cmpgt_epi8(c, _mm256_set1_epi8('a' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), c));
+            _mm256_storeu_si256((__m256i *)(data + i), _mm256_sub_epi8(c, _mm256_and_si256(lower, _mm256_set1_epi8(0x20))));
+        }
+        toUpperScalar(data + i, length - i);
+    }
+#endif
+}
+
+void SequenceKernels::Complement(char *data, size_t length)
+{
+    switch (level())
+    {
+#ifdef _SEQUENCEKERNELS_X86
+        case AVX2Level : complementAVX2(data, length);
+            break;
+        case SSE41Level : complementSSE41(data, length);
+            break;
+#endif
+        default : complementScalar(data, length);
+    }
+}
+
+void SequenceKernels::Complement(string &nucleotides)
+{
+    if (!nucleotides.empty())
+        Complement(&nucleotides[0], nucleotides.length());
+}
+
+void SequenceKernels::ReverseComplement(char *data, size_t length)
+{
+    switch (level())
+    {
+#ifdef _SEQUENCEKERNELS_X86
+        case AVX2Level : reverseComplementAVX2(data, length);
+            break;
+        case SSE41Level : reverseComplementSSE41(data, length);
+            break;
+#endif
+        default : reverseComplementScalar(data, length);
+    }
+}
+
+void SequenceKernels::ReverseComplement(string &nucleotides)
+{
+    if (!nucleotides.empty())
+        ReverseComplement(&nucleotides[0], nucleotides.length());
+}
+
+void SequenceKernels::ReverseComplement(const char *source, size_t length, char *destination)
+{
+    switch (level())
+    {
+#ifdef _SEQUENCEKERNELS_X86
+        case AVX2Level : reverseComplementAVX2(source, length, destination);
+            break;
+        case SSE41Level : reverseComplementSSE41(source, length, destination);
+            break;
+#endif
+        default : reverseComplementScalar(source, length, destination);
+    }
+}
+
+void SequenceKernels::ReverseComplement(const string &source, string &destination)
+{
+    destination.resize(source.length());
+    if (!source.empty())
+        ReverseComplement(source.data(), source.length(), &destination[0]);
+}
+
+void SequenceKernels::Reverse(char *data, size_t length)
+{
+    switch (level())
+    {
+#ifdef _SEQUENCEKERNELS_X86
+        case AVX2Level : reverseAVX2(data, length);
+            break;
+        case SSE41Level : reverseSSE41(data, length);
+            break;
+#endif
+        default : reverseScalar(data, length);
+    }
+}
+
+void SequenceKernels::Reverse(string &str)
+{
+    if (!str.empty())
+        Reverse(&str[0], str.length());
+}
+
+void SequenceKernels::ToUpper(char *data, size_t length)
+{
+    switch (level())
+    {
+#ifdef _SEQUENCEKERNELS_X86
+        case AVX2Level : toUpperAVX2(data, length);
+            break;
+        case SSE41Level : toUpperSSE41(data, length);
+            break;
+#endif
+        default : toUpperScalar(data, length);
+    }
+}
+
+void SequenceKernels::ToUpper(string &str)
+{
+    if (!str.empty())
+        ToUpper(&str[0], str.length());
+}
+
+const char *SequenceKernels::InstructionSet()
+{
+    switch (level())
+    {
+        case AVX2Level : return "AVX2";
+        case SSE41Level : return "SSE4.1";
+        default : return "scalar";
+    }
+}
@@ -0,0 +1,55 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+#ifndef _SEQUENCEKERNELS_H
+#define _SEQUENCEKERNELS_H
+
+#include <cstddef>
+#include <string>
+
+using namespace std;
+
+// Vectorised nucleotide kernels. The implementation is picked once at run time
+// (AVX2, SSE4.1 or plain C++), so the binaries do not need to be built with -march.
+// Complement follows Sequence: A/C/G/T are swapped preserving case, N, n and * are
+// kept and every other character becomes N.
+namespace SequenceKernels
+{
+    void Complement(char *data, size_t length);
+    void Complement(string &nucleotides);
+    void ReverseComplement(char *data, size_t length);
+    void ReverseComplement(string &nucleotides);
+    void ReverseComplement(const char *source, size_t length, char *destination);
+    void ReverseComplement(const string &source, string &destination);
+    void Reverse(char *data, size_t length);
+    void Reverse(string &str);
+    void ToUpper(char *data, size_t length);
+    void ToUpper(string &str);
+    const char *InstructionSet();
+}
+
+#endif
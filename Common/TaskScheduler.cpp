@@ -0,0 +1,293 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+#include "TaskScheduler.h"
+#include <algorithm>
+#include <deque>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+namespace
+{
+    typedef function<void ()> Task;
+
+    struct WorkQueue
+    {
+        mutex Lock;
+        deque<Task> Tasks;
+    };
+
+    // queue index of the pool worker running on this thread, -1 elsewhere
+    thread_local int workerIndex = -1;
+
+    class Pool
+    {
+    public:
+        // the caller of Wait counts as one of the threads, so one worker less
+        explicit Pool(int threads)
+            : queues(max(threads - 1, 0)), queued(0), stopping(false)
+        {
+            for (size_t i = 0; i < queues.size(); i++)
+                queues[i].reset(new WorkQueue());
+            for (size_t i = 0; i < queues.size(); i++)
+                workers.push_back(thread(&Pool::worker, this, (int)i));
+        }
+
+        ~Pool()
+        {
+            {
+                lock_guard<mutex> guard(sleepLock);
+                stopping = true;
+            }
+            wake.notify_all();
+            for (size_t i = 0; i < workers.size(); i++)
+                workers[i].join();
+        }
+
+        void Push(const Task &task)
+        {
+            if (workers.empty())
+            {
+                task();
+                return;
+            }
+            WorkQueue &queue = (workerIndex >= 0 ? *queues[workerIndex] : shared);
+            {
+                lock_guard<mutex> guard(queue.Lock);
+                queue.Tasks.push_back(task);
+                queued++;
+            }
+            {
+                lock_guard<mutex> guard(sleepLock);
+            }
+            wake.notify_one();
+        }
+
+        bool RunOne()
+        {
+            Task task;
+            if (!take(workerIndex, task))
+                return false;
+            task();
+            return true;
+        }
+
+    private:
+        void worker(int index)
+        {
+            workerIndex = index;
+            while (true)
+            {
+                Task task;
+                if (take(index, task))
+                {
+                    task();
+                    continue;
+                }
+                unique_lock<mutex> guard(sleepLock);
+                wake.wait(guard, [this]() { return stopping || queued > 0; });
+                if (stopping && queued == 0)
+                    break;
+            }
+        }
+
+        // own queue newest first, then the shared queue, then the oldest task of another worker
+        bool take(int index, Task &task)
+        {
+            if (index >= 0 && popBack(*queues[index], task))
+                return true;
+            if (popFront(shared, task))
+                return true;
+            int count = queues.size();
+            for (int i = 1; i <= count; i++)
+            {
+                int victim = (index + i) % count;
+                if (victim != index && popFront(*queues[victim], task))
+                    return true;
+            }
+            return false;
+        }
+
+        bool popBack(WorkQueue &queue, Task &task)
+        {
+            lock_guard<mutex> guard(queue.Lock);
+            if (queue.Tasks.empty())
+                return false;
+            task.swap(queue.Tasks.back());
+            queue.Tasks.pop_back();
+            queued--;
+            return true;
+        }
+
+        bool popFront(WorkQueue &queue, Task &task)
+        {
+            lock_guard<mutex> guard(queue.Lock);
+            if (queue.Tasks.empty())
+                return false;
+            task.swap(queue.Tasks.front());
+            queue.Tasks.pop_front();
+            queued--;
+            return true;
+        }
+
+    private:
+        vector< unique_ptr<WorkQueue> > queues;
+        WorkQueue shared;
+        vector<thread> workers;
+        atomic<int> queued;
+        bool stopping;
+        mutex sleepLock;
+        condition_variable wake;
+    };
+
+    mutex poolLock;
+    int threadCount = 0;
+    // started on first use, the workers are joined at exit
+    unique_ptr<Pool> pool;
+
+    Pool &getPool()
+    {
+        lock_guard<mutex> guard(poolLock);
+        if (!pool)
+            pool.reset(new Pool(TaskScheduler::GetThreadCount()));
+        return *pool;
+    }
+}
+
+namespace TaskScheduler
+{
+    void SetThreadCount(int threads)
+    {
+        lock_guard<mutex> guard(poolLock);
+        if (!pool)
+            threadCount = max(threads, 0);
+    }
+
+    int GetThreadCount()
+    {
+        if (threadCount > 0)
+            return threadCount;
+        return max((int)thread::hardware_concurrency(), 1);
+    }
+
+    void Run(const function<void ()> &task)
+    {
+        getPool().Push(task);
+    }
+
+    bool RunPending()
+    {
+        return getPool().RunOne();
+    }
+
+    void ParallelFor(int begin, int end, const function<void (int)> &body)
+    {
+        int count = end - begin;
+        int threads = GetThreadCount();
+        if (count <= 1 || threads <= 1)
+        {
+            for (int i = begin; i < end; i++)
+                body(i);
+            return;
+        }
+        // a few chunks per thread, so stealing can even out uneven items
+        int chunks = min(count, threads * 4);
+        TaskGroup group;
+        for (int c = 0; c < chunks; c++)
+        {
+            int from = begin + (int)((long long)count * c / chunks);
+            int to = begin + (int)((long long)count * (c + 1) / chunks);
+            group.Run([from, to, &body]() {
+                for (int i = from; i < to; i++)
+                    body(i);
+            });
+        }
+        group.Wait();
+    }
+}
+
+TaskGroup::TaskGroup()
+    : pending(0)
+{
+}
+
+TaskGroup::~TaskGroup()
+{
+    try
+    {
+        Wait();
+    }
+    catch (...)
+    {
+    }
+}
+
+void TaskGroup::Run(const function<void ()> &task)
+{
+    pending++;
+    TaskScheduler::Run([this, task]() {
+        exception_ptr failure;
+        try
+        {
+            task();
+        }
+        catch (...)
+        {
+            failure = current_exception();
+        }
+        finish(failure);
+    });
+}
+
+void TaskGroup::Wait()
+{
+    while (pending > 0)
+    {
+        if (TaskScheduler::RunPending())
+            continue;
+        unique_lock<mutex> guard(lock);
+        done.wait_for(guard, chrono::microseconds(200), [this]() { return pending == 0; });
+    }
+    // the last finish() may still hold the lock, the group must outlive it
+    unique_lock<mutex> guard(lock);
+    exception_ptr failure = error;
+    error = exception_ptr();
+    guard.unlock();
+    if (failure)
+        rethrow_exception(failure);
+}
+
+void TaskGroup::finish(exception_ptr failure)
+{
+    lock_guard<mutex> guard(lock);
+    if (failure && !error)
+        error = failure;
+    if (--pending == 0)
+        done.notify_all();
+}
@@ -0,0 +1,116 @@
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+/*
+ * Process wide work-stealing task scheduler. The thread budget is set once
+ * (SetThreadCount, normally from the tool's -threads option) and every
+ * parallel section in the process runs on the same workers instead of starting
+ * threads of its own. Each worker owns a deque: it pushes and pops its own
+ * tasks at the back and steals from the front of the others' when it runs dry;
+ * tasks submitted from outside the pool go to a shared queue. A thread that
+ * waits for a TaskGroup or a future runs queued tasks in the meantime, so
+ * nested parallel sections (components whose GA runs parallel loops) neither
+ * deadlock nor take more threads than the budget.
+ */
+
+#ifndef _TASKSCHEDULER_H
+#define _TASKSCHEDULER_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+
+using namespace std;
+
+namespace TaskScheduler
+{
+    // threads that run tasks, the waiting caller included; 0 uses all cores.
+    // Only takes effect before the first task is submitted.
+    void SetThreadCount(int threads);
+    int GetThreadCount();
+
+    // fire and forget; the task must not throw
+    void Run(const function<void ()> &task);
+    // runs one queued task on the calling thread, false if there was none
+    bool RunPending();
+
+    // body(i) for every i in [begin, end), returns when all calls are done
+    void ParallelFor(int begin, int end, const function<void (int)> &body);
+
+    template<class F>
+    future<typename result_of<F()>::type> Async(F function)
+    {
+        typedef typename result_of<F()>::type Result;
+        shared_ptr< packaged_task<Result ()> > task(new packaged_task<Result ()>(function));
+        future<Result> result = task->get_future();
+        Run([task]() { (*task)(); });
+        return result;
+    }
+
+    // Like future.get(), but runs queued tasks while the result is not ready.
+    template<class T>
+    T Wait(future<T> &result)
+    {
+        while (result.wait_for(chrono::seconds(0)) != future_status::ready)
+            if (!RunPending())
+                result.wait_for(chrono::microseconds(200));
+        return result.get();
+    }
+}
+
+// A set of tasks that is waited for as a whole. The first exception thrown by
+// a task is rethrown from Wait.
+class TaskGroup
+{
+public:
+    TaskGroup();
+    ~TaskGroup();
+
+public:
+    void Run(const function<void ()> &task);
+    void Wait();
+
+private:
+    TaskGroup(const TaskGroup &);
+    TaskGroup &operator=(const TaskGroup &);
+
+    void finish(exception_ptr error);
+
+private:
+    atomic<int> pending;
+    exception_ptr error;
+    mutex lock;
+    condition_variable done;
+};
+
+#endif
@@ -1,84 +1,101 @@
-/*
- * Common : a collection of classes (re)used throughout the scaffolder implementation.
- * Copyright (C) 2011  Alexey Gritsenko
- * 
- * This program is free software: you can redistribute it and/or modify
- * it under the terms of the GNU General Public License as published by
- * the Free Software Foundation, either version 3 of the License, or
- * (at your option) any later version.
- *
- * This program is distributed in the hope that it will be useful,
- * but WITHOUT ANY WARRANTY; without even the implied warranty of
- * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- * GNU General Public License for more details.
- *
- * You should have received a copy of the GNU General Public License
- * along with this program.  If not, see http://www.gnu.org/licenses/.
- * 
- * 
- * 
- * Email: a.gritsenko@tudelft.nl
- * Mail: Delft University of Technology
- *       Faculty of Electrical Engineering, Mathematics, and Computer Science
- *       Department of Mediamatics
- *       P.O. Box 5031
- *       2600 GA, Delft, The Netherlands
- */
-
-
-#ifndef _WRITER_H
-#define _WRITER_H
-
-#include <cstddef>
-#include <string>
-#include <vector>
-#include "Sequence.h"
-
-using namespace std;
-
-class Writer
-{
-public:
-    Writer();
-    virtual ~Writer();
-
-	bool Open(const string &filename, const string &mode = "wb");
-	bool Close();
-
-    virtual bool Write(const string &seq, const string &comment) = 0;
-    virtual bool Write(const FastASequence &seq) = 0;
-	virtual bool Write(const vector<FastASequence> &seq) = 0;
-
-protected:
-	void splitPrint(const string &seq, int num = 80);
-
-protected:
-    FILE *fout;
-	char *buf;
-};
-
-class FastAWriter: public Writer
-{
-public:
-    FastAWriter() : Writer() {}
-    ~FastAWriter() {}
-
-    bool Write(const string &seq, const string &comment);
-    bool Write(const FastASequence &seq);
-	bool Write(const vector<FastASequence> &seq);
-};
-
-class FastQWriter: public Writer
-{
-public:
-    FastQWriter() : Writer() {}
-    ~FastQWriter() {}
-
-    bool Write(const string &seq, const string &comment);
-	bool Write(const string &seq, const string &comment, const string &quality);
-    bool Write(const FastASequence &seq);
-	bool Write(const vector<FastASequence> &seq);
-	bool Write(const FastQSequence &seq);
-	bool Write(const vector<FastQSequence> &seq);
-};
-#endif
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+
+#ifndef _WRITER_H
+#define _WRITER_H
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "Sequence.h"
+#include "AsyncOutput.h"
+#include "CompressedOutput.h"
+
+using namespace std;
+
+// Records are formatted into an output buffer, which is written out once it is full.
+// In asynchronous mode full buffers are written by a background thread, in compressed
+// mode they are compressed into BGZF blocks by a pool of threads.
+class Writer
+{
+public:
+	static const size_t BufferSize = 1 << 20;
+
+public:
+    Writer();
+    virtual ~Writer();
+
+	bool Open(const string &filename, const string &mode = "wb", bool async = false);
+	// threads <= 0 compresses with the process thread budget
+	bool OpenCompressed(const string &filename, int threads = 0, bool append = false);
+	bool Close();
+
+    virtual bool Write(const string &seq, const string &comment) = 0;
+    virtual bool Write(const FastASequence &seq) = 0;
+	virtual bool Write(const vector<FastASequence> &seq) = 0;
+
+protected:
+	void splitPrint(const string &seq, int num = 80);
+	bool isOpen() const { return fout != NULL || async != NULL || compressed != NULL; }
+	void append(const string &str) { buffer.insert(buffer.end(), str.begin(), str.end()); }
+	void append(char c) { buffer.push_back(c); }
+	bool flush(bool force = false);
+
+protected:
+    FILE *fout;
+	AsyncOutput *async;
+	CompressedOutput *compressed;
+	vector<char> buffer;
+};
+
+class FastAWriter: public Writer
+{
+public:
+    FastAWriter() : Writer() {}
+    ~FastAWriter() {}
+
+    bool Write(const string &seq, const string &comment);
+    bool Write(const FastASequence &seq);
+	bool Write(const vector<FastASequence> &seq);
+};
+
+class FastQWriter: public Writer
+{
+public:
+    FastQWriter() : Writer() {}
+    ~FastQWriter() {}
+
+    bool Write(const string &seq, const string &comment);
+	bool Write(const string &seq, const string &comment, const string &quality);
+    bool Write(const FastASequence &seq);
+	bool Write(const vector<FastASequence> &seq);
+	bool Write(const FastQSequence &seq);
+	bool Write(const vector<FastQSequence> &seq);
+};
+#endif
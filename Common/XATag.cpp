@@ -1,56 +1,79 @@
-/*
- * Common : a collection of classes (re)used throughout the scaffolder implementation.
- * Copyright (C) 2011  Alexey Gritsenko
- * 
- * This program is free software: you can redistribute it and/or modify
- * it under the terms of the GNU General Public License as published by
- * the Free Software Foundation, either version 3 of the License, or
- * (at your option) any later version.
- *
- * This program is distributed in the hope that it will be useful,
- * but WITHOUT ANY WARRANTY; without even the implied warranty of
- * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- * GNU General Public License for more details.
- *
- * You should have received a copy of the GNU General Public License
- * along with this program.  If not, see http://www.gnu.org/licenses/.
- * 
- * 
- * 
- * Email: a.gritsenko@tudelft.nl
- * Mail: Delft University of Technology
- *       Faculty of Electrical Engineering, Mathematics, and Computer Science
- *       Department of Mediamatics
- *       P.O. Box 5031
- *       2600 GA, Delft, The Netherlands
- */
-
-#include "XATag.h"
-#include "Helpers.h"
-
-XATag::XATag(const BamAlignment &alg)
-{
-	RefID = alg.RefID;
-	Position = alg.Position;
-	IsReverseStrand = alg.IsReverseStrand();
-}
-
-XATag::XATag(const string &str, const BamReader &reader)
-{
-        if (str.empty())
-                throw new exception();
-        int n = str.length();
-        int i = 0, s = 0;
-        while (i < n - 1 && str[i] != ',') i++;
-        string name = str.substr(0, i);
-        s = ++i; while (i < n - 1 && str[i] != ',') i++;
-        string position = str.substr(s, i - s);
-        if (position.empty())
-                throw new exception();
-        if (position[0] != '+' && position[0] != '-')
-                throw new exception();
-        RefID = reader.GetReferenceID(name);
-		bool tmp;
-        Position = Helpers::ParseInt(position.c_str() + 1, tmp);
-        IsReverseStrand = position[0] == '-';
-}
+/*
+ * Common : a collection of classes (re)used throughout the scaffolder implementation.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+#include "XATag.h"
+#include "Helpers.h"
+#include <cstring>
+
+XATag::XATag(const BamAlignment &alg)
+{
+	RefID = alg.RefID;
+	Position = alg.Position;
+	IsReverseStrand = alg.IsReverseStrand();
+}
+
+XATag::XATag(const string &str, const BamReader &reader)
+{
+        if (str.empty())
+                throw new exception();
+        int n = str.length();
+        int i = 0, s = 0;
+        while (i < n - 1 && str[i] != ',') i++;
+        string name = str.substr(0, i);
+        s = ++i; while (i < n - 1 && str[i] != ',') i++;
+        string position = str.substr(s, i - s);
+        if (position.empty())
+                throw new exception();
+        if (position[0] != '+' && position[0] != '-')
+                throw new exception();
+        RefID = reader.GetReferenceID(name);
+		bool tmp;
+        Position = Helpers::ParseInt(position.c_str() + 1, tmp);
+        IsReverseStrand = position[0] == '-';
+}
+
+// Appends the hits of an XA tag ("name,[+-]position,CIGAR,NM;" each) without copying it.
+void XATag::Parse(const char *xa, size_t length, const NameIndex &references, vector<XATag> &tags)
+{
+	const char *end = xa + length;
+	while (xa < end)
+	{
+		const char *entryEnd = (const char *)memchr(xa, ';', end - xa);
+		if (entryEnd == NULL)
+			break;
+		const char *comma = (const char *)memchr(xa, ',', entryEnd - xa);
+		if (comma != NULL && comma + 1 < entryEnd)
+		{
+			const char *position = comma + 1;
+			int value = 0;
+			for (const char *c = position + 1; c < entryEnd && *c >= '0' && *c <= '9'; c++)
+				value = value * 10 + (*c - '0');
+			tags.push_back(XATag(value, references.Find(xa, comma - xa), *position == '-'));
+		}
+		xa = entryEnd + 1;
+	}
+}
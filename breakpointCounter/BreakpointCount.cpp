@@ -51,7 +51,7 @@ bool BreakpointCount::IsBreakpoint(const MummerCoord &a, const MummerCoord &b)
     return false;
 }
 
-int BreakpointCount::ProcessAlignments(const vector<MummerCoord> &coords, const vector<FastASequence> &references, const vector<FastASequence> &scaffolds)
+int BreakpointCount::ProcessAlignments(const vector<MummerCoord> &coords, const FastAIndex &references, const FastAIndex &scaffolds)
 {
     resizeCoverageVector(*referenceCoverage, references);
     resizeCoverageVector(*scaffoldCoverage, scaffolds);
@@ -149,10 +149,10 @@ int BreakpointCount::getReferenceDistance(const MummerCoord &a, const MummerCoor
     return (a.IsQueryReverse == a.IsReferenceReverse ? b.ReferencePosition - a.ReferencePosition - a.ReferenceAlignmentLength : a.ReferencePosition - b.ReferencePosition - b.ReferenceAlignmentLength);
 }
 
-void BreakpointCount::resizeCoverageVector(Depth &depth, const vector<FastASequence> &seq)
+void BreakpointCount::resizeCoverageVector(Depth &depth, const FastAIndex &seq)
 {
-    int nSeq = seq.size();
+    int nSeq = seq.Count();
     depth.resize(nSeq, vector<bool>());
     for (int i = 0; i < nSeq; i++)
-        depth[i].resize(seq[i].Nucleotides.length());
+        depth[i].resize(seq[i].Length);
 }
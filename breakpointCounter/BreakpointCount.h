@@ -9,7 +9,7 @@
 #define	_BREAKPOINTCOUNT_H
 
 #include "MummerCoord.h"
-#include "Sequence.h"
+#include "FastAIndex.h"
 #include <vector>
 #include <memory>
 
@@ -25,7 +25,7 @@ public:
     
 public:
     bool IsBreakpoint(const MummerCoord &a, const MummerCoord &b);
-    int ProcessAlignments(const vector<MummerCoord> &coords, const vector<FastASequence> &references, const vector<FastASequence> &scaffolds);
+    int ProcessAlignments(const vector<MummerCoord> &coords, const FastAIndex &references, const FastAIndex &scaffolds);
     double GetReferenceCoverage() const;
     double GetScaffoldCoverage() const;
     
@@ -50,7 +50,7 @@ private:
 private:
     static int getQueryDistance(const MummerCoord &a, const MummerCoord &b);
     static int getReferenceDistance(const MummerCoord &a, const MummerCoord &b);
-    static void resizeCoverageVector(Depth &depth, const vector<FastASequence> &seq);
+    static void resizeCoverageVector(Depth &depth, const FastAIndex &seq);
     
 private:
     auto_ptr<Depth> scaffoldCoverage;
@@ -34,43 +34,55 @@
 #include <boost/shared_array.hpp>
 #include "Configuration.h"
 #include "Sequence.h"
-#include "Reader.h"
+#include "FastAIndex.h"
 #include "Aligner.h"
+#include "ScratchSpace.h"
 #include "MummerCoord.h"
 #include "MummerCoordReader.h"
 #include "BreakpointCount.h"
 
 using namespace std;
 
-typedef vector<FastASequence> Sequences;
 typedef vector<MummerCoord> Coords;
 
 Configuration config;
-auto_ptr<Sequences> scaffolds;
-auto_ptr<Sequences> references;
+// only names and lengths are needed, sequences are never loaded
+auto_ptr<FastAIndex> scaffolds;
+auto_ptr<FastAIndex> references;
 auto_ptr<Coords> coords;
 BreakpointCount breakpoints;
 
 
-bool readContigs(const string &fileName, Sequences &contigs)
+bool readContigs(const string &fileName, FastAIndex &contigs)
 {
-    FastAReader reader;
-    bool result = reader.Open(fileName) && reader.Read(contigs) > 0;
-    reader.Close();
-    return result;
+    return contigs.Open(fileName) && contigs.Count() > 0;
 }
 
-bool alignScaffolds(const string &referenceFileName, const string &scaffoldsFileName, const Sequences &references, const Sequences &scaffolds, Coords &coords)
+// alignments that cover too few bases are dropped as they are read
+bool alignScaffolds(const string &referenceFileName, const string &scaffoldsFileName, const FastAIndex &references, const FastAIndex &scaffolds, double minBases, Coords &coords, int &filtered)
 {
     MummerAligner aligner(referenceFileName, scaffoldsFileName, config.MummerConfig);
-    MummerCoordReader reader(references, scaffolds);
+    MummerCoordReader reader(references.GetNames(), scaffolds.GetNames());
     if (!aligner.Align())
     {
         cerr << "[-] Unable to align scaffolds to reference (" << scaffoldsFileName << " -> " << referenceFileName << ")." << endl;
         return false;
     }
     aligner.RemoveOutput = false;
-    if (!reader.Open(aligner.OutputFileName) || reader.Read(coords) == 0)
+    coords.clear();
+    filtered = 0;
+    MummerCoord coord;
+    if (reader.Open(aligner.OutputFileName))
+    {
+        while (reader.Read(coord))
+        {
+            if (coord.Identity * coord.ReferenceAlignmentLength > minBases)
+                coords.push_back(coord);
+            else
+                filtered++;
+        }
+    }
+    if (coords.empty() && filtered == 0)
     {
         cerr << "[-] Unable to read MUMMER alignment (" << aligner.OutputFileName << ")." << endl;
         return false;
@@ -78,19 +90,6 @@ bool alignScaffolds(const string &referenceFileName, const string &scaffoldsFile
     return true;
 }
 
-int filterAlignments(Coords &coords, double minBases)
-{
-    int count = 0;
-    Coords newCoords;
-    for (auto it = coords.begin(); it != coords.end(); it++)
-        if (it->Identity * it->ReferenceAlignmentLength > minBases)
-            newCoords.push_back(*it);
-        else
-            count++;
-    coords.swap(newCoords);
-    return count;
-}
-
 void output(const Coords &coords)
 {
     for (Coords::const_iterator it = coords.begin(); it != coords.end(); it++)
@@ -108,12 +107,12 @@ void banner()
 int main(int argc, char* argv[])
 {
     banner();
-    srand((unsigned int)time(NULL));
-    scaffolds = auto_ptr<Sequences>(new Sequences());
-    references = auto_ptr<Sequences>(new Sequences());
+    scaffolds = auto_ptr<FastAIndex>(new FastAIndex());
+    references = auto_ptr<FastAIndex>(new FastAIndex());
     coords = auto_ptr<Coords>(new Coords());
     if (config.ProcessCommandLine(argc, argv))
     {
+        ScratchSpace::SetMemoryBudget((long long)config.ScratchMemory << 20);
         if (!readContigs(config.ScaffoldFileName, *scaffolds))
         {
             cerr << "[-] Unable to read scaffolds (" << config.ScaffoldFileName << ")." << endl;
@@ -126,13 +125,14 @@ int main(int argc, char* argv[])
             return -3;
         }
         cerr << "[+] Read references (" << config.ReferenceFileName << ")." << endl;
-        if (!alignScaffolds(config.ReferenceFileName, config.ScaffoldFileName, *references, *scaffolds, *coords))
+        int filtered;
+        if (!alignScaffolds(config.ReferenceFileName, config.ScaffoldFileName, *references, *scaffolds, config.MinBases, *coords, filtered))
             return -4;
         breakpoints.DistanceThreshold = config.DistanceThreshold;
         cout << "[+] Aligned scaffolds to reference (" << config.ScaffoldFileName << " -> " << config.ReferenceFileName << ")." << endl;
         BreakpointCount::Sort(*coords);
         cerr << "[+] Sorted MUMMER alignments." << endl;
-        cout << "[i] Filtered out " << filterAlignments(*coords, config.MinBases) << " alignments." << endl;
+        cout << "[i] Filtered out " << filtered << " alignments." << endl;
         cout << "[i] Found a total of " << breakpoints.ProcessAlignments(*coords, *references, *scaffolds) << " breakpoints:" << endl;
         cout << "    [i] Joins:\t" << breakpoints.Joins << endl;
         cout << "    [i] Order:\t" << breakpoints.Order << endl;
@@ -42,13 +42,14 @@
 #include <cstring>
 #include "Configuration.h"
 #include "ReadCoverageReader.h"
-#include "Reader.h"
+#include "FastAIndex.h"
 #include "Sequence.h"
 
 using namespace std;
 
 typedef vector< boost::shared_array<int> > Depth;
-typedef vector<FastASequence> Sequences;
+// contigs are only indexed, their sequences are never loaded
+typedef FastAIndex Sequences;
 
 Configuration config;
 auto_ptr<ReadCoverage> coverage;
@@ -58,10 +59,7 @@ auto_ptr<Sequences> contigs;
 
 bool readContigs(const string &fileName, Sequences &contigs)
 {
-    FastAReader reader;
-    bool result = reader.Open(fileName) && reader.Read(contigs) > 0;
-    reader.Close();
-    return result;
+    return contigs.Open(fileName) && contigs.Count() > 0;
 }
 
 bool readCoverage(const string &fileName, ReadCoverage &coverage)
@@ -72,22 +70,54 @@ bool readCoverage(const string &fileName, ReadCoverage &coverage)
     return result;
 }
 
+// adds count reads of the given length starting at position start to the depth differences
+void addReads(vector<int> &difference, int start, int length, int count)
+{
+    int contigLength = (int)difference.size() - 1;
+    int from = max(start, 0), to = min(start + length, contigLength);
+    if (from >= to)
+        return;
+    difference[from] += count;
+    difference[to] -= count;
+}
+
 bool calculateDepth(const ReadCoverage &coverage, const Sequences &contigs, Depth &depth)
 {
     int nContigs = coverage.GetContigCount();
-    if (nContigs != (int)contigs.size())
+    if (nContigs != contigs.Count())
         return false;
     //depth.assign(nContigs, vector<int>());
     int avgReadLength = (int)coverage.AverageReadLength;
     for (int i = 0; i < nContigs; i++)
     {
-        int contigLength = contigs[i].Nucleotides.length();
+        int contigLength = contigs[i].Length;
         depth[i] = boost::shared_array<int>(new int[contigLength]);
-        memset(depth[i].get(), 0, contigLength * sizeof(int));
-        for (vector<int>::const_iterator it = coverage.ReadLocations[i].begin(); it != coverage.ReadLocations[i].end(); it++)
+        vector<int> difference(contigLength + 1, 0);
+        if (!coverage.Summarized)
+        {
+            for (vector<int>::const_iterator it = coverage.ReadLocations[i].begin(); it != coverage.ReadLocations[i].end(); it++)
+                addReads(difference, *it, avgReadLength, 1);
+        }
+        else if (coverage.Resolution > 0)
         {
-            for (int k = max(*it, 0); k < *it + avgReadLength && k < contigLength; k++)
-                depth[i][k]++;
+            // the read starts of a histogram bin are placed in the middle of the bin
+            const vector<int> &histogram = coverage.Summaries[i].Histogram;
+            for (int j = 0; j < (int)histogram.size(); j++)
+                addReads(difference, min(j * coverage.Resolution + coverage.Resolution / 2, contigLength - 1), avgReadLength, histogram[j]);
+        }
+        else if (contigLength > 0)
+        {
+            // without a histogram the read bases are spread evenly over the contig
+            int average = (int)(coverage.Summaries[i].Bases / contigLength);
+            difference[0] += average;
+            difference[contigLength] -= average;
+        }
+
+        int current = 0;
+        for (int k = 0; k < contigLength; k++)
+        {
+            current += difference[k];
+            depth[i][k] = current;
         }
     }
     return true;
@@ -99,10 +129,10 @@ bool outputDepth(const string &fileName, const Sequences &contigs, const Depth &
     if (out == NULL)
         return false;
     
-    int nContigs = contigs.size();
+    int nContigs = contigs.Count();
     for (int i = 0; i < nContigs; i++)
     {
-        int contigLength = contigs[i].Nucleotides.length();
+        int contigLength = contigs[i].Length;
         for (int j = 0; j < contigLength; j++)
             fprintf(out, "%i\n", depth[i][j]);
     }
@@ -110,17 +140,23 @@ bool outputDepth(const string &fileName, const Sequences &contigs, const Depth &
     return true;
 }
 
-bool outputMIPSformat(const Sequences &contigs, const Depth &depth)
+bool outputMIPSformat(const ReadCoverage &coverage, Sequences &contigs, const Depth &depth)
 {
-    int nContigs = contigs.size();
+    int nContigs = contigs.Count();
     for (int i = 0; i < nContigs; i++)
     {
-        int contigLength = contigs[i].Nucleotides.length();
+        int contigLength = contigs[i].Length;
         long long coverageSum = 0;
-        for (int j = 0; j < contigLength; j++)
-            coverageSum += depth[i][j];
+        // summaries hold the exact number of read bases on the contig
+        if (coverage.Summarized)
+            coverageSum = coverage.Summaries[i].Bases;
+        else
+            for (int j = 0; j < contigLength; j++)
+                coverageSum += depth[i][j];
         double averageCoverage = (double)coverageSum / (double)contigLength;
-        cout << i + 1 << "\t" << contigs[i].Comment << "\t" << contigLength << "\t" << averageCoverage << endl;
+        string comment;
+        contigs.GetComment(i, comment);
+        cout << i + 1 << "\t" << comment << "\t" << contigLength << "\t" << averageCoverage << endl;
     }
     return true;
 }
@@ -136,7 +172,6 @@ void banner()
 int main(int argc, char* argv[])
 {
     banner();
-    srand((unsigned int)time(NULL));
     coverage = auto_ptr<ReadCoverage>(new ReadCoverage());
     contigs = auto_ptr<Sequences>(new Sequences());
     if (config.ProcessCommandLine(argc, argv))
@@ -146,7 +181,7 @@ int main(int argc, char* argv[])
             cerr << "[-] Unable to read contigs (" << config.ContigFileName << ")." << endl;
             return -2;
         }
-        depth = auto_ptr<Depth>(new Depth(contigs->size(), boost::shared_array<int>())); // otherwise we get a segfault. Resizing vector in place in a pain (stack overrun?)
+        depth = auto_ptr<Depth>(new Depth(contigs->Count(), boost::shared_array<int>())); // otherwise we get a segfault. Resizing vector in place in a pain (stack overrun?)
         cerr << "[+] Read contigs (" << config.ContigFileName << ")." << endl;
         if (!readCoverage(config.CoverageFileName, *coverage))
         {
@@ -169,7 +204,7 @@ int main(int argc, char* argv[])
             }
             cerr << "[+] Output coverage depth (" << config.DepthFileName << ")." << endl;
         }
-        if (!outputMIPSformat(*contigs, *depth))
+        if (!outputMIPSformat(*coverage, *contigs, *depth))
         {
             cerr << "[-] Unable to output coverage statistics." << endl;
             return -4;
@@ -1,114 +1,136 @@
-/*
- * dataFilter : a support tool used in debugging to filter paired reads aligning
- * to gaps between contigs.
- * Copyright (C) 2011  Alexey Gritsenko
- * 
- * This program is free software: you can redistribute it and/or modify
- * it under the terms of the GNU General Public License as published by
- * the Free Software Foundation, either version 3 of the License, or
- * (at your option) any later version.
- *
- * This program is distributed in the hope that it will be useful,
- * but WITHOUT ANY WARRANTY; without even the implied warranty of
- * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- * GNU General Public License for more details.
- *
- * You should have received a copy of the GNU General Public License
- * along with this program.  If not, see http://www.gnu.org/licenses/.
- * 
- * 
- * 
- * Email: a.gritsenko@tudelft.nl
- * Mail: Delft University of Technology
- *       Faculty of Electrical Engineering, Mathematics, and Computer Science
- *       Department of Mediamatics
- *       P.O. Box 5031
- *       2600 GA, Delft, The Netherlands
- */
-
-#include "Configuration.h"
-#include "Defines.h"
-#include "Helpers.h"
-#include <iostream>
-#include <cstring>
-#include <cstdlib>
-#include <sstream>
-
-using namespace std;
-
-PairedInput::PairedInput(const string &leftFileName, const string &rightFileName, const string &outputPrefix)
-	: LeftFileName(leftFileName), RightFileName(rightFileName), OutputPrefix(outputPrefix)
-{
-}
-
-// Construtor with default configuration parameter settings.
-Configuration::Configuration()
-{
-	Success = false;
-	InputFileName = "";
-}
-
-// Parses command line arguments. Returns true if successful.
-bool Configuration::ProcessCommandLine(int argc, char *argv[])
-{
-	this->Success = true;
-	stringstream serr;
-
-	if (argc == 1)
-	{
-		serr << "[-] Not enough arguments. Consult -help." << endl;
-		this->Success = false;
-	}
-	else
-	{
-		int i = 1;
-		while (i < argc)
-		{
-			if (!strcmp("-help", argv[i]) || !strcmp("-h", argv[i]))
-			{
-				printHelpMessage(serr);
-				this->Success = false;
-				break;
-			}
-			else if (!strcmp("-paired", argv[i]))
-			{
-				if (argc - i - 1 < 1)
-				{
-					cerr << "[-] Parsing error in -paired: must have three arguments." << endl;
-					this->Success = false;
-					break;
-				}
-				i++; string leftFileName = argv[i];
-				i++; string rightFileName = argv[i];
-				i++; string outputPrefix = argv[i];
-				PairedFilter.push_back(PairedInput(leftFileName, rightFileName, outputPrefix));
-			}
-			else if (i == argc - 1)
-				this->InputFileName = argv[argc - 1];
-			else
-			{
-				serr << "[-] Unknown argument: " << argv[i] << endl;
-				this->Success = false;
-				break;
-			}
-			i++;
-		}
-		if (this->InputFileName == "")
-		{
-			serr << "[-] No input file specified." << endl;
-			this->Success = false;
-		}
-	}
-	if (!this->Success)
-		LastError = serr.str();
-	return this->Success;
-}
-
-void Configuration::printHelpMessage(stringstream &serr)
-{
-	serr << "[i] Data filter version " << VERSION << " (" << DATE << ")" << endl;
-	serr << "[i] By " << AUTHOR << endl;
-	serr << "[i] Usage: dataFilter [arguments] <contigs.fasta>" << endl;
-	serr << "[i] -help                                               Print this message and exit." << endl;
-	serr << "[i] -paired <left-file> <right-file> <output-prefix>    Filter paired reads and output them with given prefix." << endl;
-}
+/*
+ * dataFilter : a support tool used in debugging to filter paired reads aligning
+ * to gaps between contigs.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+#include "Configuration.h"
+#include "Defines.h"
+#include "Helpers.h"
+#include <iostream>
+#include <cstring>
+#include <cstdlib>
+#include <sstream>
+
+using namespace std;
+
+PairedInput::PairedInput(const string &leftFileName, const string &rightFileName, const string &outputPrefix)
+	: LeftFileName(leftFileName), RightFileName(rightFileName), OutputPrefix(outputPrefix)
+{
+}
+
+// Construtor with default configuration parameter settings.
+Configuration::Configuration()
+{
+	Success = false;
+	InputFileName = "";
+	CompressOutput = false;
+}
+
+// Parses command line arguments. Returns true if successful.
+bool Configuration::ProcessCommandLine(int argc, char *argv[])
+{
+	this->Success = true;
+	stringstream serr;
+
+	if (argc == 1)
+	{
+		serr << "[-] Not enough arguments. Consult -help." << endl;
+		this->Success = false;
+	}
+	else
+	{
+		int i = 1;
+		while (i < argc)
+		{
+			if (!strcmp("-help", argv[i]) || !strcmp("-h", argv[i]))
+			{
+				printHelpMessage(serr);
+				this->Success = false;
+				break;
+			}
+			else if (!strcmp("-paired", argv[i]))
+			{
+				if (argc - i - 1 < 1)
+				{
+					cerr << "[-] Parsing error in -paired: must have three arguments." << endl;
+					this->Success = false;
+					break;
+				}
+				i++; string leftFileName = argv[i];
+				i++; string rightFileName = argv[i];
+				i++; string outputPrefix = argv[i];
+				PairedFilter.push_back(PairedInput(leftFileName, rightFileName, outputPrefix));
+			}
+			else if (!strcmp("-compress", argv[i]))
+			{
+				if (argc - i - 1 < 1)
+				{
+					serr << "[-] Parsing error in -compress: must have an argument." << endl;
+					this->Success = false;
+					break;
+				}
+				i++;
+				if (!strcasecmp(argv[i], "yes"))
+					this->CompressOutput = true;
+				else if (!strcasecmp(argv[i], "no"))
+					this->CompressOutput = false;
+				else
+				{
+					serr << "[-] Parsing error in -compress: argument must be yes/no." << endl;
+					this->Success = false;
+					break;
+				}
+			}
+			else if (i == argc - 1)
+				this->InputFileName = argv[argc - 1];
+			else
+			{
+				serr << "[-] Unknown argument: " << argv[i] << endl;
+				this->Success = false;
+				break;
+			}
+			i++;
+		}
+		if (this->InputFileName == "")
+		{
+			serr << "[-] No input file specified." << endl;
+			this->Success = false;
+		}
+	}
+	if (!this->Success)
+		LastError = serr.str();
+	return this->Success;
+}
+
+void Configuration::printHelpMessage(stringstream &serr)
+{
+	serr << "[i] Data filter version " << VERSION << " (" << DATE << ")" << endl;
+	serr << "[i] By " << AUTHOR << endl;
+	serr << "[i] Usage: dataFilter [arguments] <contigs.fasta>" << endl;
+	serr << "[i] -help                                               Print this message and exit." << endl;
+	serr << "[i] -paired <left-file> <right-file> <output-prefix>    Filter paired reads and output them with given prefix." << endl;
+	serr << "[i] -compress <yes/no>                                  Write the filtered reads as BGZF compressed FastQ files (.fastq.gz)? [no]" << endl;
+}
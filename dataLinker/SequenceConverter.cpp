@@ -28,7 +28,7 @@
 #include "SequenceConverter.h"
 #include "Aligner.h"
 #include "MummerTilingReader.h"
-#include "Reader.h"
+#include "FastAIndex.h"
 #include <algorithm>
 #include <sstream>
 
@@ -41,15 +41,7 @@ SequenceConverter::SequenceConverter(DataStore &store)
 
 SequenceConverter::SequenceConverterResult SequenceConverter::Process(const Configuration &config, const SequenceInput &input)
 {
-    SequenceConverterResult result;
-    Coords coords;
-    result = alignContigs(input.FileName, config, coords);
-    if (result != Success)
-        return result;
-    //sortAlignments(coords);
-    createLinksFromAlignment(addLinkGroup(input), coords, input);
-    
-    return result;
+    return alignContigs(input.FileName, config, input);
 }
 
 int SequenceConverter::addLinkGroup(const SequenceInput &input)
@@ -60,36 +52,41 @@ int SequenceConverter::addLinkGroup(const SequenceInput &input)
     return dataStore.AddGroup(group);
 }
 
-SequenceConverter::SequenceConverterResult SequenceConverter::alignContigs(const string &sequenceFileName, const Configuration &config, Coords &coords)
+SequenceConverter::SequenceConverterResult SequenceConverter::alignContigs(const string &sequenceFileName, const Configuration &config, const SequenceInput &input)
 {
     MummerTiler tiler(sequenceFileName, config.InputFileName, config.MummerTilerConfig);
-    std::vector<FastASequence> references;
-    FastAReader faReader;
-    if (!faReader.Open(sequenceFileName) || faReader.Read(references) <= 0)
+    // only the sequence names are needed to map the alignments
+    FastAIndex references;
+    if (!references.Open(sequenceFileName) || references.Count() <= 0)
         return FailedReadSequences;
-    MummerTilingReader reader(references, dataStore.GetContigs());
+    vector<string> contigNames(dataStore.ContigCount);
+    for (int i = 0; i < dataStore.ContigCount; i++)
+        contigNames[i] = dataStore[i].Sequence.Name();
+    MummerTilingReader reader(references.GetNames(), contigNames);
     if (!tiler.Align())
         return FailedAlignment;
-    if (!reader.Open(tiler.OutputFileName) || reader.Read(coords) == 0)
+    MummerTiling first;
+    if (!reader.Open(tiler.OutputFileName) || !reader.Read(first))
         return FailedReadAlignment;
+    // tilings are turned into links as they are parsed
+    createLinksFromAlignment(addLinkGroup(input), first, reader, input);
     return Success;
 }
 
-void SequenceConverter::createLinksFromAlignment(int groupID, Coords &tilings, const SequenceInput &input)
+void SequenceConverter::createLinksFromAlignment(int groupID, const MummerTiling &first, MummerTilingReader &reader, const SequenceInput &input)
 {
-    MummerTiling t;
-    auto prev = tilings.begin();
-    for (auto cur = prev + 1; cur != tilings.end(); prev++, cur++)
+    MummerTiling prev = first, cur;
+    for (; reader.Read(cur); prev = cur)
     {
-        if (prev->ReferenceID == cur->ReferenceID && prev->QueryID != cur->QueryID)
+        if (prev.ReferenceID == cur.ReferenceID && prev.QueryID != cur.QueryID)
         {
-            int distance = cur->ReferencePosition - prev->ReferencePosition + cur->QueryLength;
-            bool equalOrientation = !(prev->IsReverse ^ cur->IsReverse);
-            bool forwardOrder = !prev->IsReverse;
-            double weight = input.Weight * cur->Identity * prev->Identity * prev->Coverage * cur->Coverage;
-            ContigLink link(prev->QueryID, cur->QueryID, distance, input.Std, equalOrientation, forwardOrder, weight);
+            int distance = cur.ReferencePosition - prev.ReferencePosition + cur.QueryLength;
+            bool equalOrientation = !(prev.IsReverse ^ cur.IsReverse);
+            bool forwardOrder = !prev.IsReverse;
+            double weight = input.Weight * cur.Identity * prev.Identity * prev.Coverage * cur.Coverage;
+            ContigLink link(prev.QueryID, cur.QueryID, distance, input.Std, equalOrientation, forwardOrder, weight);
             dataStore.AddLink(groupID, link);
-            //cout << "   added link between " << prev->QueryID << " and " << cur->QueryID << " of weight " << weight << endl;
+            //cout << "   added link between " << prev.QueryID << " and " << cur.QueryID << " of weight " << weight << endl;
         }
     }
 }
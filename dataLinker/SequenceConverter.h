@@ -31,6 +31,7 @@
 #include "Configuration.h"
 #include "DataStore.h"
 #include "MummerTiling.h"
+#include "MummerTilingReader.h"
 
 #include <string>
 #include <vector>
@@ -47,9 +48,9 @@ public:
     SequenceConverterResult Process(const Configuration &config, const SequenceInput &input);
 
 private:
-    SequenceConverterResult alignContigs(const std::string &sequenceFileName, const Configuration &config, Coords &coords);
+    SequenceConverterResult alignContigs(const std::string &sequenceFileName, const Configuration &config, const SequenceInput &input);
     int addLinkGroup(const SequenceInput &input);
-    void createLinksFromAlignment(int groupID, Coords &coords, const SequenceInput &input);
+    void createLinksFromAlignment(int groupID, const MummerTiling &first, MummerTilingReader &reader, const SequenceInput &input);
     static void sortAlignments(Coords &coords);
     
 private:
@@ -1,110 +1,131 @@
-/*
- * readDiff : a tool used in debugging. Calculates a difference of two read sets.
- * Copyright (C) 2011  Alexey Gritsenko
- * 
- * This program is free software: you can redistribute it and/or modify
- * it under the terms of the GNU General Public License as published by
- * the Free Software Foundation, either version 3 of the License, or
- * (at your option) any later version.
- *
- * This program is distributed in the hope that it will be useful,
- * but WITHOUT ANY WARRANTY; without even the implied warranty of
- * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- * GNU General Public License for more details.
- *
- * You should have received a copy of the GNU General Public License
- * along with this program.  If not, see http://www.gnu.org/licenses/.
- * 
- * 
- * 
- * Email: a.gritsenko@tudelft.nl
- * Mail: Delft University of Technology
- *       Faculty of Electrical Engineering, Mathematics, and Computer Science
- *       Department of Mediamatics
- *       P.O. Box 5031
- *       2600 GA, Delft, The Netherlands
- */
-
-#include "Configuration.h"
-#include "Defines.h"
-#include "Helpers.h"
-#include <iostream>
-#include <cstring>
-#include <cstdlib>
-#include <sstream>
-
-using namespace std;
-
-// Construtor with default configuration parameter settings.
-Configuration::Configuration()
-{
-	Success = false;
-	AFileName = "";
-	BFileName = "";
-	CFileName = "";
-}
-
-// Parses command line arguments. Returns true if successful.
-bool Configuration::ProcessCommandLine(int argc, char *argv[])
-{
-	this->Success = true;
-	stringstream serr;
-
-	if (argc == 1)
-	{
-		serr << "[-] Not enough arguments. Consult -help." << endl;
-		this->Success = false;
-	}
-	else
-	{
-		int i = 1;
-		while (i < argc)
-		{
-			if (!strcmp("-help", argv[i]) || !strcmp("-h", argv[i]))
-			{
-				printHelpMessage(serr);
-				this->Success = false;
-				break;
-			}
-			else if (i == argc - 3)
-				this->AFileName = argv[argc - 3];
-			else if (i == argc - 2)
-				this->BFileName = argv[argc - 2];
-			else if (i == argc - 1)
-				this->CFileName = argv[argc - 1];
-			else
-			{
-				serr << "[-] Unknown argument: " << argv[i] << endl;
-				this->Success = false;
-				break;
-			}
-			i++;
-		}
-		if (this->AFileName == "")
-		{
-			serr << "[-] No first input file specified." << endl;
-			this->Success = false;
-		}
-		if (this->BFileName == "")
-		{
-			serr << "[-] No second input file specified." << endl;
-			this->Success = false;
-		}
-		if (this->CFileName == "")
-		{
-			serr << "[-] No output file specified." << endl;
-			this->Success = false;
-		}
-	}
-	if (!this->Success)
-		LastError = serr.str();
-	return this->Success;
-}
-
-void Configuration::printHelpMessage(stringstream &serr)
-{
-	serr << "[i] Read set difference calculator out = (A - B). Version " << VERSION << " (" << DATE << ")" << endl;
-	serr << "[i] By " << AUTHOR << endl;
-	serr << "[i] Usage: readDiff [arguments] <A.fasta> <B.fasta> <out.fasta>" << endl;
-	serr << "[i] -help                                               Print this message and exit." << endl;
-}
+/*
+ * readDiff : a tool used in debugging. Calculates a difference of two read sets.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+#include "Configuration.h"
+#include "Defines.h"
+#include "Helpers.h"
+#include <iostream>
+#include <cstring>
+#include <cstdlib>
+#include <sstream>
+
+using namespace std;
+
+// Construtor with default configuration parameter settings.
+Configuration::Configuration()
+{
+	Success = false;
+	AFileName = "";
+	BFileName = "";
+	CFileName = "";
+	Threads = 0;
+}
+
+// Parses command line arguments. Returns true if successful.
+bool Configuration::ProcessCommandLine(int argc, char *argv[])
+{
+	this->Success = true;
+	stringstream serr;
+
+	if (argc == 1)
+	{
+		serr << "[-] Not enough arguments. Consult -help." << endl;
+		this->Success = false;
+	}
+	else
+	{
+		int i = 1;
+		while (i < argc)
+		{
+			if (!strcmp("-help", argv[i]) || !strcmp("-h", argv[i]))
+			{
+				printHelpMessage(serr);
+				this->Success = false;
+				break;
+			}
+			else if (!strcmp("-threads", argv[i]) && i < argc - 3)
+			{
+				if (argc - i - 1 < 1)
+				{
+					serr << "[-] Parsing error in -threads: must have an argument." << endl;
+					this->Success = false;
+					break;
+				}
+				i++;
+				bool threadsSuccess;
+				int threads = Helpers::ParseInt(argv[i], threadsSuccess);
+				if (!threadsSuccess || threads < 0)
+				{
+					serr << "[-] Parsing error in -threads: number of threads must be a non-negative number." << endl;
+					this->Success = false;
+					break;
+				}
+				this->Threads = threads;
+			}
+			else if (i == argc - 3)
+				this->AFileName = argv[argc - 3];
+			else if (i == argc - 2)
+				this->BFileName = argv[argc - 2];
+			else if (i == argc - 1)
+				this->CFileName = argv[argc - 1];
+			else
+			{
+				serr << "[-] Unknown argument: " << argv[i] << endl;
+				this->Success = false;
+				break;
+			}
+			i++;
+		}
+		if (this->AFileName == "")
+		{
+			serr << "[-] No first input file specified." << endl;
+			this->Success = false;
+		}
+		if (this->BFileName == "")
+		{
+			serr << "[-] No second input file specified." << endl;
+			this->Success = false;
+		}
+		if (this->CFileName == "")
+		{
+			serr << "[-] No output file specified." << endl;
+			this->Success = false;
+		}
+	}
+	if (!this->Success)
+		LastError = serr.str();
+	return this->Success;
+}
+
+void Configuration::printHelpMessage(stringstream &serr)
+{
+	serr << "[i] Read set difference calculator out = (A - B). Version " << VERSION << " (" << DATE << ")" << endl;
+	serr << "[i] By " << AUTHOR << endl;
+	serr << "[i] Usage: readDiff [arguments] <A.fasta> <B.fasta> <out.fasta>" << endl;
+	serr << "[i] -help                                               Print this message and exit." << endl;
+	serr << "[i] -threads <n>                                        Number of threads used to parse the input files. [all cores]" << endl;
+}
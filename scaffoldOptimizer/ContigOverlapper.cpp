@@ -29,6 +29,7 @@
 #include "ContigOverlapper.h"
 #include "NWAligner.h"
 #include "Configuration.h"
+#include "Profiler.h"
 
 #include <iostream>
 #include <cstdio>
@@ -40,6 +41,7 @@ int ContigOverlapper::FindBestOverlap(const std::string &left, const std::string
     if (left.empty() || right.empty()) // empty sequences do not overlap
         return 0;
     
+    ProfileScope scope("Overlap alignment");
     int leftLen = left.length(), rightLen = right.length();
     
     int maxDeviation = config.InitialOverlapDeviation;
@@ -68,6 +70,7 @@ int ContigOverlapper::FindBestOverlap(const std::string &left, const std::string
         // check if overlapLen is too large to align!
         if (overlapLen <= config.MaximumAlignmentLength)
         {
+            scope.Count("alignments", 1);
             double alignmentScore = (double)GetAlignmentScore(leftSequence, rightSequence) / (double)(2 * overlapLen); // [-1.5; 1] alignment score
             double score = alignmentScore * distanceScore;
             if (score > bestScore)
@@ -1,507 +1,504 @@
-/*
- * scaffoldOptimizer : solves the MIQP optimization and produces linear scaffold
- * sequences.
- * Copyright (C) 2011  Alexey Gritsenko
- * 
- * This program is free software: you can redistribute it and/or modify
- * it under the terms of the GNU General Public License as published by
- * the Free Software Foundation, either version 3 of the License, or
- * (at your option) any later version.
- *
- * This program is distributed in the hope that it will be useful,
- * but WITHOUT ANY WARRANTY; without even the implied warranty of
- * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- * GNU General Public License for more details.
- *
- * You should have received a copy of the GNU General Public License
- * along with this program.  If not, see http://www.gnu.org/licenses/.
- * 
- * 
- * 
- * Email: a.gritsenko@tudelft.nl
- * Mail: Delft University of Technology
- *       Faculty of Electrical Engineering, Mathematics, and Computer Science
- *       Department of Mediamatics
- *       P.O. Box 5031
- *       2600 GA, Delft, The Netherlands
- */
-
-#include "MIQPSolver.h"
-#include <cstdlib>
-#include "Globals.h"
-#include "Helpers.h"
-#include <cmath>
-
-ILOMIPINFOCALLBACK3(BestObjectiveReachedCallback,
-                    IloNum, relGap,
-					IloBool, aborted,
-					IloNum, bestObjective)
-{
-	if (!aborted  &&  hasIncumbent())
-	{
-		IloNum objective = getIncumbentObjValue();
-		if (fabs(objective - bestObjective) <= fabs(bestObjective) * relGap)
-			abort();
-	}
-};
-
-MIQPSolver::MIQPSolver()
-	: model(environment), x(environment), u(environment), t(environment), xi_f(environment), xi_r(environment), delta_f(environment), delta_r(environment), xi_f_ut(environment), xi_f_tt(environment), xi_r_tu(environment), xi_r_tt(environment), xi_f_uu(environment), xi_f_tu(environment), delta_f_ut(environment), delta_f_tt(environment), delta_r_tu(environment), delta_r_tt(environment), delta_f_uu(environment), delta_f_tu(environment), constraints(environment), g(environment), h(environment), p(environment), s(environment)
-{
-	bestObjective = 1;
-	ContigCount = 0;
-	status = Clean;
-}
-
-MIQPSolver::~MIQPSolver()
-{
-	environment.end();
-}
-
-bool MIQPSolver::Formulate(const DataStore &store, const vector<double> &coord)
-{
-	if (status != Clean)
-		return false;
-	if (!formulate(store) || !addCoordinateConstraints(coord) || !createModel())
-	{
-		status = Fail;
-		return false;
-	}
-	return true;
-}
-
-bool MIQPSolver::Formulate(const DataStore &store)
-{
-	if (status != Clean)
-		return false;
-	if (!formulate(store) || !createModel())
-	{
-		status = Fail;
-		return false;
-	}
-	status = Formulated;
-	return true;
-}
-
-bool MIQPSolver::Solve()
-{
-	if (status < Formulated)
-		return false;
-	if (ContigCount == 1)
-	{
-		U[0] = true;
-		T[0] = false;
-		X[0] = 0;
-	}
-	else
-	{
-		try
-		{
-			cplex.setParam(cplex.ParallelMode, (Options.UseOpportunisticSearch ? -1 : 1));
-			cplex.setParam(cplex.Threads, Options.Threads);
-			if (Options.SuppressOutput)
-			{
-				cplex.setOut(environment.getNullStream());
-				cplex.setError(environment.getNullStream());
-				cplex.setWarning(environment.getNullStream());
-			}
-			if (Options.TimeLimit > 0)
-				cplex.setParam(cplex.TiLim, Options.TimeLimit);
-			if (Options.UseObjectiveHeuristic)
-				cplex.use(BestObjectiveReachedCallback(environment, cplex.getParam(cplex.EpGap), false, bestObjective));
-			//cplex.setParam(cplex.NumericalEmphasis, 1);
-			if (!cplex.solve())
-			{
-				cout << cplex.getStatus() << endl; // REMOVE ME
-				return false;
-			}
-			saveSolution();
-		}
-		catch (...)
-		{
-			status = Fail;
-			return false;
-		}
-	}
-	status = Success;
-	return true;
-}
-
-SolverStatus MIQPSolver::GetStatus() const
-{
-	return status;
-}
-
-double MIQPSolver::GetObjective() const
-{
-	if (status == Success)
-		return cplex.getObjValue();
-	return -Helpers::Inf;
-}
-
-IloAlgorithm::Status MIQPSolver::GetCplexStatus() const
-{
-	return cplex.getStatus();
-}
-
-bool MIQPSolver::formulate(const DataStore &store)
-{
-	if (!addContigs(store))
-		return false;
-	if (!addLinks(store))
-		return false;
-	if (!appendSizeObjective())
-		return false;
-	return true;
-}
-
-bool MIQPSolver::addContigs(const DataStore &store)
-{
-	ContigCount = store.ContigCount;
-	len.resize(ContigCount);
-	U.resize(ContigCount);
-	T.resize(ContigCount);
-	X.resize(ContigCount);
-	optimized.resize(ContigCount);
-	for (int i = 0; i < ContigCount; i++)
-		if (!addContig(store[i]))
-			return false;
-	return true;
-}
-
-bool MIQPSolver::addContig(const Contig &contig)
-{
-	int id = contig.GetID();
-	try
-	{
-		len[id] = contig.Sequence.Nucleotides.length();
-		optimized[id] = false;
-		x.add(IloNumVar(environment, 0, CoordMax));
-		u.add(IloBoolVar(environment));
-		t.add(IloBoolVar(environment));
-		constraints.add(t[id] - u[id] <= 0);
-	}
-	catch (...)
-	{
-		return false;
-	}
-	return true;
-}
-
-bool MIQPSolver::addLinks(const DataStore &store)
-{
-	int num = 0;
-	for (DataStore::LinkMap::const_iterator it = store.Begin(); it != store.End(); it++)
-	{
-		if (!addLink(num, it->first.first, it->first.second, it->second))
-			return false;
-		++num;
-	}
-	return true;
-}
-
-bool MIQPSolver::addLink(int num, int a, int b, const ContigLink &link)
-{
-	// See paper for formulae
-	bool e = link.EqualOrientation;
-	bool r = link.ForwardOrder;
-	double mu = link.Mean;
-	double sigma = link.Std;
-	double w = link.Weight;
-	bestObjective += w;
-	optimized[a] = optimized[b] = true;
-
-	if (!addDistanceConstraint(a, b, e, r, sigma, mu))
-		return false;
-	if (!addOrderConstraint(a, b, e, r))
-		return false;
-	if (!appendOrientationObjective(a, b, e, w))
-		return false;
-	if (!appendDistanceObjective(a, b, e, w, xi_f[num], xi_r[num]))
-		return false;
-	if (!appendOrderObjective(a, b, e, w, delta_f[num], delta_r[num]))
-		return false;
-	return true;
-}
-
-bool MIQPSolver::addDistanceConstraint(int a, int b, bool e, bool r, double sigma, double mu)
-{
-	try
-	{
-		IloNumVar xi_f_l(environment, 0, SlackMax), xi_r_l(environment, 0, SlackMax);
-		xi_f.add(xi_f_l);
-		xi_r.add(xi_r_l);
-		if (!e && !r)
-		{
-			constraints.add(x[a] - x[b] - sigma * xi_f_l <=   DistanceStdDev * sigma + mu - len[a] - len[b]);
-			constraints.add(x[a] - x[b] + sigma * xi_f_l >= - DistanceStdDev * sigma + mu - len[a] - len[b]);
-			constraints.add(x[b] - x[a] - sigma * xi_r_l <=   DistanceStdDev * sigma + mu - len[a] - len[b]);
-			constraints.add(x[b] - x[a] + sigma * xi_r_l >= - DistanceStdDev * sigma + mu - len[a] - len[b]);
-		}
-		else if (!e && r)
-		{
-			constraints.add(x[b] - x[a] - sigma * xi_f_l <=   DistanceStdDev * sigma + mu);
-			constraints.add(x[b] - x[a] + sigma * xi_f_l >= - DistanceStdDev * sigma + mu);
-			constraints.add(x[a] - x[b] - sigma * xi_r_l <=   DistanceStdDev * sigma + mu);
-			constraints.add(x[a] - x[b] + sigma * xi_r_l >= - DistanceStdDev * sigma + mu);
-		}
-		else if (e && !r)
-		{
-			constraints.add(x[a] - x[b] - sigma * xi_f_l <=   DistanceStdDev * sigma + mu - len[a]);
-			constraints.add(x[a] - x[b] + sigma * xi_f_l >= - DistanceStdDev * sigma + mu - len[a]);
-			constraints.add(x[b] - x[a] - sigma * xi_r_l <=   DistanceStdDev * sigma + mu - len[a]);
-			constraints.add(x[b] - x[a] + sigma * xi_r_l >= - DistanceStdDev * sigma + mu - len[a]);
-		}
-		else if (e && r)
-		{
-			constraints.add(x[b] - x[a] - sigma * xi_f_l <=   DistanceStdDev * sigma + mu - len[b]);
-			constraints.add(x[b] - x[a] + sigma * xi_f_l >= - DistanceStdDev * sigma + mu - len[b]);
-			constraints.add(x[a] - x[b] - sigma * xi_r_l <=   DistanceStdDev * sigma + mu - len[b]);
-			constraints.add(x[a] - x[b] + sigma * xi_r_l >= - DistanceStdDev * sigma + mu - len[b]);
-		}
-	}
-	catch (...)
-	{
-		return false;
-	}
-	return true;
-}
-
-bool MIQPSolver::addOrderConstraint(int a, int b, bool e, bool r)
-{
-	try
-	{
-		IloNumVar delta_f_l(environment, 0, SlackMax), delta_r_l(environment, 0, SlackMax);
-		delta_f.add(delta_f_l);
-		delta_r.add(delta_r_l);
-		if (!e && !r)
-		{
-			constraints.add(x[a] - x[b] + delta_f_l >= -len[b]);
-			constraints.add(x[b] - x[a] + delta_r_l >= -len[a]);
-		}
-		else if (!e && r)
-		{
-			constraints.add(x[b] - x[a] + delta_f_l >= len[b]);
-			constraints.add(x[a] - x[b] + delta_r_l >= len[a]);
-		}
-		else if (e && !r)
-		{
-			constraints.add(x[a] - x[b] + delta_f_l >= 0);
-			constraints.add(x[b] - x[a] + delta_r_l >= len[b] - len[a]);
-		}
-		else if (e && r)
-		{
-			constraints.add(x[b] - x[a] + delta_f_l >= 0);
-			constraints.add(x[a] - x[b] + delta_r_l >= len[a] - len[b]);
-		}
-	}
-	catch (...)
-	{
-		return false;
-	}
-	return true;
-}
-
-bool MIQPSolver::appendOrientationObjective(int a, int b, bool e, double w)
-{
-	try
-	{
-		if (!e)
-			g = g - w * (u[a] - 2 * t[a]) * (u[b] - 2 * t[b]);
-		else
-			g = g + w * (u[a] - 2 * t[a]) * (u[b] - 2 * t[b]);
-	}
-	catch (...)
-	{
-		return false;
-	}
-	return true;
-}
-
-bool MIQPSolver::appendDistanceObjective(int a, int b, bool e, double w, const IloNumVar &xi_f_l, const IloNumVar &xi_r_l)
-{
-	try
-	{
-		/*IloNumVar xi_f_ut_l(environment, 0, SlackMax), xi_f_tt_l(environment, 0, SlackMax), xi_r_tu_l(environment, 0, SlackMax), xi_r_tt_l(environment, 0, SlackMax), xi_f_uu_l(environment, 0, SlackMax), xi_f_tu_l(environment, 0, SlackMax);
-		xi_f_uu.add(xi_f_uu_l);
-		constraints.add(xi_f_uu_l - xi_f_l <= 0);
-		constraints.add(xi_f_uu_l - SlackMax * u[a] <= 0);
-		constraints.add(xi_f_uu_l - SlackMax * u[b] <= 0);
-		constraints.add(xi_f_l - xi_f_uu_l + SlackMax * (u[a] + u[b])  <= 2 * SlackMax);
-		xi_f_ut.add(xi_f_ut_l);
-		constraints.add(xi_f_ut_l - xi_f_l <= 0);
-		constraints.add(xi_f_ut_l - SlackMax * u[a] <= 0);
-		constraints.add(xi_f_ut_l - SlackMax * t[b] <= 0);
-		constraints.add(xi_f_l - xi_f_ut_l + SlackMax * (u[a] + t[b])  <= 2 * SlackMax);
-		xi_f_tu.add(xi_f_tu_l);
-		constraints.add(xi_f_tu_l - xi_f_l <= 0);
-		constraints.add(xi_f_tu_l - SlackMax * t[a] <= 0);
-		constraints.add(xi_f_tu_l - SlackMax * u[b] <= 0);
-		constraints.add(xi_f_l - xi_f_tu_l + SlackMax * (t[a] + u[b])  <= 2 * SlackMax);
-		xi_f_tt.add(xi_f_tt_l);
-		constraints.add(xi_f_tt_l - xi_f_l <= 0);
-		constraints.add(xi_f_tt_l - SlackMax * t[a] <= 0);
-		constraints.add(xi_f_tt_l - SlackMax * t[b] <= 0);
-		constraints.add(xi_f_l - xi_f_tt_l + SlackMax * (t[a] + t[b])  <= 2 * SlackMax);
-		xi_r_tu.add(xi_r_tu_l);
-		constraints.add(xi_r_tu_l - xi_r_l <= 0);
-		constraints.add(xi_r_tu_l - SlackMax * t[a] <= 0);
-		constraints.add(xi_r_tu_l - SlackMax * u[b] <= 0);
-		constraints.add(xi_r_l - xi_r_tu_l + SlackMax * (t[a] + u[b])  <= 2 * SlackMax);
-		xi_r_tt.add(xi_r_tt_l);
-		constraints.add(xi_r_tt_l - xi_r_l <= 0);
-		constraints.add(xi_r_tt_l - SlackMax * t[a] <= 0);
-		constraints.add(xi_r_tt_l - SlackMax * t[b] <= 0);
-		constraints.add(xi_r_l - xi_r_tt_l + SlackMax * (t[a] + t[b])  <= 2 * SlackMax);*/
-		IloNumVar xi_f_ut_l(environment, 0, SlackMax), xi_f_tt_l(environment, 0, SlackMax), xi_r_tu_l(environment, 0, SlackMax);
-		IloNumVar xi_r_tt_l(environment, 0, SlackMax), xi_f_uu_l(environment, 0, SlackMax), xi_f_tu_l(environment, 0, SlackMax);
-		xi_f_ut.add(xi_f_ut_l);
-		xi_f_tt.add(xi_f_tt_l);
-		xi_r_tu.add(xi_r_tu_l);
-		xi_r_tt.add(xi_r_tt_l);
-		xi_f_uu.add(xi_f_uu_l);
-		xi_f_tu.add(xi_f_tu_l);
-		constraints.add(xi_f_ut_l - xi_f_l <= 0);
-		constraints.add(xi_f_tt_l - xi_f_l <= 0);
-		constraints.add(xi_r_tu_l - xi_r_l <= 0);
-		constraints.add(xi_r_tt_l - xi_r_l <= 0);
-		constraints.add(xi_f_uu_l - xi_f_l <= 0);
-		constraints.add(xi_f_tu_l - xi_f_l <= 0);
-		constraints.add(xi_f_ut_l - SlackMax * u[a] <= 0);
-		constraints.add(xi_f_tt_l - SlackMax * t[a] <= 0);
-		constraints.add(xi_r_tu_l - SlackMax * t[a] <= 0);
-		constraints.add(xi_r_tt_l - SlackMax * t[a] <= 0);
-		constraints.add(xi_f_uu_l - SlackMax * u[a] <= 0);
-		constraints.add(xi_f_tu_l - SlackMax * t[a] <= 0);
-		constraints.add(xi_f_ut_l - SlackMax * t[b] <= 0);
-		constraints.add(xi_f_tt_l - SlackMax * t[b] <= 0);
-		constraints.add(xi_r_tu_l - SlackMax * u[b] <= 0);
-		constraints.add(xi_r_tt_l - SlackMax * t[b] <= 0);
-		constraints.add(xi_f_uu_l - SlackMax * u[b] <= 0);
-		constraints.add(xi_f_tu_l - SlackMax * u[b] <= 0);
-		constraints.add(xi_f_l - xi_f_ut_l + SlackMax * (u[a] + t[b]) <= 2 * SlackMax);
-		constraints.add(xi_f_l - xi_f_tt_l + SlackMax * (t[a] + t[b]) <= 2 * SlackMax);
-		constraints.add(xi_r_l - xi_r_tu_l + SlackMax * (t[a] + u[b]) <= 2 * SlackMax);
-		constraints.add(xi_r_l - xi_r_tt_l + SlackMax * (t[a] + t[b]) <= 2 * SlackMax);
-		constraints.add(xi_f_l - xi_f_uu_l + SlackMax * (u[a] + u[b]) <= 2 * SlackMax);
-		constraints.add(xi_f_l - xi_f_tu_l + SlackMax * (t[a] + u[b]) <= 2 * SlackMax);
-		if (!e)
-			h = h + w * (xi_f_ut_l - xi_f_tt_l + xi_r_tu_l - xi_r_tt_l);
-		else
-			h = h - w * (xi_f_ut_l - xi_f_tt_l - xi_r_tt_l) + w * (xi_f_uu_l - xi_f_tu_l);
-	}
-	catch (...)
-	{
-		return false;
-	}
-	return true;
-}
-
-bool MIQPSolver::appendOrderObjective(int a, int b, bool e, double w, const IloNumVar &delta_f_l, const IloNumVar &delta_r_l)
-{
-	try
-	{
-		IloNumVar delta_f_ut_l(environment, 0, SlackMax), delta_f_tt_l(environment, 0, SlackMax), delta_r_tu_l(environment, 0, SlackMax);
-		IloNumVar delta_r_tt_l(environment, 0, SlackMax), delta_f_uu_l(environment, 0, SlackMax), delta_f_tu_l(environment, 0, SlackMax);
-		delta_f_ut.add(delta_f_ut_l);
-		delta_f_tt.add(delta_f_tt_l);
-		delta_r_tu.add(delta_r_tu_l);
-		delta_r_tt.add(delta_r_tt_l);
-		delta_f_uu.add(delta_f_uu_l);
-		delta_f_tu.add(delta_f_tu_l);
-		constraints.add(delta_f_ut_l - delta_f_l <= 0);
-		constraints.add(delta_f_tt_l - delta_f_l <= 0);
-		constraints.add(delta_r_tu_l - delta_r_l <= 0);
-		constraints.add(delta_r_tt_l - delta_r_l <= 0);
-		constraints.add(delta_f_uu_l - delta_f_l <= 0);
-		constraints.add(delta_f_tu_l - delta_f_l <= 0);
-		constraints.add(delta_f_ut_l - SlackMax * u[a] <= 0);
-		constraints.add(delta_f_tt_l - SlackMax * t[a] <= 0);
-		constraints.add(delta_r_tu_l - SlackMax * t[a] <= 0);
-		constraints.add(delta_r_tt_l - SlackMax * t[a] <= 0);
-		constraints.add(delta_f_uu_l - SlackMax * u[a] <= 0);
-		constraints.add(delta_f_tu_l - SlackMax * t[a] <= 0);
-		constraints.add(delta_f_ut_l - SlackMax * t[b] <= 0);
-		constraints.add(delta_f_tt_l - SlackMax * t[b] <= 0);
-		constraints.add(delta_r_tu_l - SlackMax * u[b] <= 0);
-		constraints.add(delta_r_tt_l - SlackMax * t[b] <= 0);
-		constraints.add(delta_f_uu_l - SlackMax * u[b] <= 0);
-		constraints.add(delta_f_tu_l - SlackMax * u[b] <= 0);
-		constraints.add(delta_f_l - delta_f_ut_l + SlackMax * (u[a] + t[b]) <= 2 * SlackMax);
-		constraints.add(delta_f_l - delta_f_tt_l + SlackMax * (t[a] + t[b]) <= 2 * SlackMax);
-		constraints.add(delta_r_l - delta_r_tu_l + SlackMax * (t[a] + u[b]) <= 2 * SlackMax);
-		constraints.add(delta_r_l - delta_r_tt_l + SlackMax * (t[a] + t[b]) <= 2 * SlackMax);
-		constraints.add(delta_f_l - delta_f_uu_l + SlackMax * (u[a] + u[b]) <= 2 * SlackMax);
-		constraints.add(delta_f_l - delta_f_tu_l + SlackMax * (t[a] + u[b]) <= 2 * SlackMax);
-		if (!e)
-			p = p + w * (delta_f_ut_l - delta_f_tt_l + delta_r_tu_l - delta_r_tt_l);
-		else
-			p = p - w * (delta_f_ut_l - delta_f_tt_l - delta_r_tt_l) + w * (delta_f_uu_l - delta_f_tu_l);
-	}
-	catch (...)
-	{
-		return false;
-	}
-	return true;
-}
-
-bool MIQPSolver::addCoordinateConstraints(const vector<double> &coord)
-{
-	if ((int)coord.size() != ContigCount)
-		return false;
-	try
-	{
-		for (int i = 0; i < ContigCount; i++)
-			constraints.add(x[i] == coord[i]);
-	}
-	catch (...)
-	{
-		return false;
-	}
-	return true;
-}
-
-bool MIQPSolver::appendSizeObjective()
-{
-	try 
-	{
-		for (int i = 0; i < ContigCount; i++)
-			s = s + u[i];
-		s = s / ContigCount;
-	}
-	catch (...)
-	{
-		return false;
-	}
-	return true;
-}
-
-bool MIQPSolver::createModel()
-{
-	try
-	{
-		model.add(IloMaximize(environment, g - h - p + s));
-		model.add(constraints);
-		cplex = IloCplex(model);
-	}
-	catch (...)
-	{
-		return false;
-	}
-	return true;
-}
-
-void MIQPSolver::saveSolution()
-{
-	double minX = Helpers::Inf;
-	for (int i = 0; i < ContigCount; i++)
-	{
-		U[i] = cplex.getValue(u[i]) == 1;
-		T[i] = cplex.getValue(t[i]) == 1;
-		X[i] = (U[i] && optimized[i] ? cplex.getValue(x[i]) : 0);
-		if (U[i])
-			minX = min(minX, (T[i] == 1 ? X[i] - (len[i] == 0 ? 0 : len[i] - 1) : X[i]));
-	}
-	for (int i = 0; i < ContigCount; i++)
-		if (U[i]) X[i] -= minX;
-}
+/*
+ * scaffoldOptimizer : solves the MIQP optimization and produces linear scaffold
+ * sequences.
+ * Copyright (C) 2011  Alexey Gritsenko
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ * 
+ * 
+ * 
+ * Email: a.gritsenko@tudelft.nl
+ * Mail: Delft University of Technology
+ *       Faculty of Electrical Engineering, Mathematics, and Computer Science
+ *       Department of Mediamatics
+ *       P.O. Box 5031
+ *       2600 GA, Delft, The Netherlands
+ */
+
+#include "MIQPSolver.h"
+#include <cstdlib>
+#include "Globals.h"
+#include "Helpers.h"
+#include <cmath>
+
+ILOMIPINFOCALLBACK3(BestObjectiveReachedCallback,
+                    IloNum, relGap,
+					IloBool, aborted,
+					IloNum, bestObjective)
+{
+	if (!aborted  &&  hasIncumbent())
+	{
+		IloNum objective = getIncumbentObjValue();
+		if (fabs(objective - bestObjective) <= fabs(bestObjective) * relGap)
+			abort();
+	}
+};
+
+MIQPSolver::MIQPSolver()
+	: model(environment), x(environment), u(environment), t(environment), xi_f(environment), xi_r(environment), delta_f(environment), delta_r(environment), xi_f_ut(environment), xi_f_tt(environment), xi_r_tu(environment), xi_r_tt(environment), xi_f_uu(environment), xi_f_tu(environment), delta_f_ut(environment), delta_f_tt(environment), delta_r_tu(environment), delta_r_tt(environment), delta_f_uu(environment), delta_f_tu(environment), constraints(environment), g(environment), h(environment), p(environment), s(environment)
+{
+	bestObjective = 1;
+	ContigCount = 0;
+	status = Clean;
+}
+
+MIQPSolver::~MIQPSolver()
+{
+	environment.end();
+}
+
+bool MIQPSolver::Formulate(const DataStoreView &store, const vector<double> &coord)
+{
+	if (status != Clean)
+		return false;
+	if (!formulate(store) || !addCoordinateConstraints(coord) || !createModel())
+	{
+		status = Fail;
+		return false;
+	}
+	return true;
+}
+
+bool MIQPSolver::Formulate(const DataStoreView &store)
+{
+	if (status != Clean)
+		return false;
+	if (!formulate(store) || !createModel())
+	{
+		status = Fail;
+		return false;
+	}
+	status = Formulated;
+	return true;
+}
+
+bool MIQPSolver::Solve()
+{
+	if (status < Formulated)
+		return false;
+	if (ContigCount == 1)
+	{
+		U[0] = true;
+		T[0] = false;
+		X[0] = 0;
+	}
+	else
+	{
+		try
+		{
+			cplex.setParam(cplex.ParallelMode, (Options.UseOpportunisticSearch ? -1 : 1));
+			cplex.setParam(cplex.Threads, Options.Threads);
+			if (Options.SuppressOutput)
+			{
+				cplex.setOut(environment.getNullStream());
+				cplex.setError(environment.getNullStream());
+				cplex.setWarning(environment.getNullStream());
+			}
+			if (Options.TimeLimit > 0)
+				cplex.setParam(cplex.TiLim, Options.TimeLimit);
+			if (Options.UseObjectiveHeuristic)
+				cplex.use(BestObjectiveReachedCallback(environment, cplex.getParam(cplex.EpGap), false, bestObjective));
+			//cplex.setParam(cplex.NumericalEmphasis, 1);
+			if (!cplex.solve())
+			{
+				cout << cplex.getStatus() << endl; // REMOVE ME
+				return false;
+			}
+			saveSolution();
+		}
+		catch (...)
+		{
+			status = Fail;
+			return false;
+		}
+	}
+	status = Success;
+	return true;
+}
+
+SolverStatus MIQPSolver::GetStatus() const
+{
+	return status;
+}
+
+double MIQPSolver::GetObjective() const
+{
+	if (status == Success)
+		return cplex.getObjValue();
+	return -Helpers::Inf;
+}
+
+IloAlgorithm::Status MIQPSolver::GetCplexStatus() const
+{
+	return cplex.getStatus();
+}
+
+bool MIQPSolver::formulate(const DataStoreView &store)
+{
+	if (!addContigs(store))
+		return false;
+	if (!addLinks(store))
+		return false;
+	if (!appendSizeObjective())
+		return false;
+	return true;
+}
+
+bool MIQPSolver::addContigs(const DataStoreView &store)
+{
+	ContigCount = store.ContigCount;
+	len.resize(ContigCount);
+	U.resize(ContigCount);
+	T.resize(ContigCount);
+	X.resize(ContigCount);
+	optimized.resize(ContigCount);
+	for (int i = 0; i < ContigCount; i++)
+		if (!addContig(store[i]))
+			return false;
+	return true;
+}
+
+bool MIQPSolver::addContig(const Contig &contig)
+{
+	int id = contig.GetID();
+	try
+	{
+		len[id] = contig.Sequence.Nucleotides.Length();
+		optimized[id] = false;
+		x.add(IloNumVar(environment, 0, CoordMax));
+		u.add(IloBoolVar(environment));
+		t.add(IloBoolVar(environment));
+		constraints.add(t[id] - u[id] <= 0);
+	}
+	catch (...)
+	{
+		return false;
+	}
+	return true;
+}
+
+bool MIQPSolver::addLinks(const DataStoreView &store)
+{
+	const LinkTable &links = store.Links();
+	for (int num = 0; num < links.Size(); num++)
+		if (!addLink(num, links.First(num), links.Second(num), links.Get(num)))
+			return false;
+	return true;
+}
+
+bool MIQPSolver::addLink(int num, int a, int b, const ContigLink &link)
+{
+	// See paper for formulae
+	bool e = link.EqualOrientation;
+	bool r = link.ForwardOrder;
+	double mu = link.Mean;
+	double sigma = link.Std;
+	double w = link.Weight;
+	bestObjective += w;
+	optimized[a] = optimized[b] = true;
+
+	if (!addDistanceConstraint(a, b, e, r, sigma, mu))
+		return false;
+	if (!addOrderConstraint(a, b, e, r))
+		return false;
+	if (!appendOrientationObjective(a, b, e, w))
+		return false;
+	if (!appendDistanceObjective(a, b, e, w, xi_f[num], xi_r[num]))
+		return false;
+	if (!appendOrderObjective(a, b, e, w, delta_f[num], delta_r[num]))
+		return false;
+	return true;
+}
+
+bool MIQPSolver::addDistanceConstraint(int a, int b, bool e, bool r, double sigma, double mu)
+{
+	try
+	{
+		IloNumVar xi_f_l(environment, 0, SlackMax), xi_r_l(environment, 0, SlackMax);
+		xi_f.add(xi_f_l);
+		xi_r.add(xi_r_l);
+		if (!e && !r)
+		{
+			constraints.add(x[a] - x[b] - sigma * xi_f_l <=   DistanceStdDev * sigma + mu - len[a] - len[b]);
+			constraints.add(x[a] - x[b] + sigma * xi_f_l >= - DistanceStdDev * sigma + mu - len[a] - len[b]);
+			constraints.add(x[b] - x[a] - sigma * xi_r_l <=   DistanceStdDev * sigma + mu - len[a] - len[b]);
+			constraints.add(x[b] - x[a] + sigma * xi_r_l >= - DistanceStdDev * sigma + mu - len[a] - len[b]);
+		}
+		else if (!e && r)
+		{
+			constraints.add(x[b] - x[a] - sigma * xi_f_l <=   DistanceStdDev * sigma + mu);
+			constraints.add(x[b] - x[a] + sigma * xi_f_l >= - DistanceStdDev * sigma + mu);
+			constraints.add(x[a] - x[b] - sigma * xi_r_l <=   DistanceStdDev * sigma + mu);
+			constraints.add(x[a] - x[b] + sigma * xi_r_l >= - DistanceStdDev * sigma + mu);
+		}
+		else if (e && !r)
+		{
+			constraints.add(x[a] - x[b] - sigma * xi_f_l <=   DistanceStdDev * sigma + mu - len[a]);
+			constraints.add(x[a] - x[b] + sigma * xi_f_l >= - DistanceStdDev * sigma + mu - len[a]);
+			constraints.add(x[b] - x[a] - sigma * xi_r_l <=   DistanceStdDev * sigma + mu - len[a]);
+			constraints.add(x[b] - x[a] + sigma * xi_r_l >= - DistanceStdDev * sigma + mu - len[a]);
+		}
+		else if (e && r)
+		{
+			constraints.add(x[b] - x[a] - sigma * xi_f_l <=   DistanceStdDev * sigma + mu - len[b]);
+			constraints.add(x[b] - x[a] + sigma * xi_f_l >= - DistanceStdDev * sigma + mu - len[b]);
+			constraints.add(x[a] - x[b] - sigma * xi_r_l <=   DistanceStdDev * sigma + mu - len[b]);
+			constraints.add(x[a] - x[b] + sigma * xi_r_l >= - DistanceStdDev * sigma + mu - len[b]);
+		}
+	}
+	catch (...)
+	{
+		return false;
+	}
+	return true;
+}
+
+bool MIQPSolver::addOrderConstraint(int a, int b, bool e, bool r)
+{
+	try
+	{
+		IloNumVar delta_f_l(environment, 0, SlackMax), delta_r_l(environment, 0, SlackMax);
+		delta_f.add(delta_f_l);
+		delta_r.add(delta_r_l);
+		if (!e && !r)
+		{
+			constraints.add(x[a] - x[b] + delta_f_l >= -len[b]);
+			constraints.add(x[b] - x[a] + delta_r_l >= -len[a]);
+		}
+		else if (!e && r)
+		{
+			constraints.add(x[b] - x[a] + delta_f_l >= len[b]);
+			constraints.add(x[a] - x[b] + delta_r_l >= len[a]);
+		}
+		else if (e && !r)
+		{
+			constraints.add(x[a] - x[b] + delta_f_l >= 0);
+			constraints.add(x[b] - x[a] + delta_r_l >= len[b] - len[a]);
+		}
+		else if (e && r)
+		{
+			constraints.add(x[b] - x[a] + delta_f_l >= 0);
+			constraints.add(x[a] - x[b] + delta_r_l >= len[a] - len[b]);
+		}
+	}
+	catch (...)
+	{
+		return false;
+	}
+	return true;
+}
+
+bool MIQPSolver::appendOrientationObjective(int a, int b, bool e, double w)
+{
+	try
+	{
+		if (!e)
+			g = g - w * (u[a] - 2 * t[a]) * (u[b] - 2 * t[b]);
+		else
+			g = g + w * (u[a] - 2 * t[a]) * (u[b] - 2 * t[b]);
+	}
+	catch (...)
+	{
+		return false;
+	}
+	return true;
+}
+
+bool MIQPSolver::appendDistanceObjective(int a, int b, bool e, double w, const IloNumVar &xi_f_l, const IloNumVar &xi_r_l)
+{
+	try
+	{
+		/*IloNumVar xi_f_ut_l(environment, 0, SlackMax), xi_f_tt_l(environment, 0, SlackMax), xi_r_tu_l(environment, 0, SlackMax), xi_r_tt_l(environment, 0, SlackMax), xi_f_uu_l(environment, 0, SlackMax), xi_f_tu_l(environment, 0, SlackMax);
+		xi_f_uu.add(xi_f_uu_l);
+		constraints.add(xi_f_uu_l - xi_f_l <= 0);
+		constraints.add(xi_f_uu_l - SlackMax * u[a] <= 0);
+		constraints.add(xi_f_uu_l - SlackMax * u[b] <= 0);
+		constraints.add(xi_f_l - xi_f_uu_l + SlackMax * (u[a] + u[b])  <= 2 * SlackMax);
+		xi_f_ut.add(xi_f_ut_l);
+		constraints.add(xi_f_ut_l - xi_f_l <= 0);
+		constraints.add(xi_f_ut_l - SlackMax * u[a] <= 0);
+		constraints.add(xi_f_ut_l - SlackMax * t[b] <= 0);
+		constraints.add(xi_f_l - xi_f_ut_l + SlackMax * (u[a] + t[b])  <= 2 * SlackMax);
+		xi_f_tu.add(xi_f_tu_l);
+		constraints.add(xi_f_tu_l - xi_f_l <= 0);
+		constraints.add(xi_f_tu_l - SlackMax * t[a] <= 0);
+		constraints.add(xi_f_tu_l - SlackMax * u[b] <= 0);
+		constraints.add(xi_f_l - xi_f_tu_l + SlackMax * (t[a] + u[b])  <= 2 * SlackMax);
+		xi_f_tt.add(xi_f_tt_l);
+		constraints.add(xi_f_tt_l - xi_f_l <= 0);
+		constraints.add(xi_f_tt_l - SlackMax * t[a] <= 0);
+		constraints.add(xi_f_tt_l - SlackMax * t[b] <= 0);
+		constraints.add(xi_f_l - xi_f_tt_l + SlackMax * (t[a] + t[b])  <= 2 * SlackMax);
+		xi_r_tu.add(xi_r_tu_l);
+		constraints.add(xi_r_tu_l - xi_r_l <= 0);
+		constraints.add(xi_r_tu_l - SlackMax * t[a] <= 0);
+		constraints.add(xi_r_tu_l - SlackMax * u[b] <= 0);
+		constraints.add(xi_r_l - xi_r_tu_l + SlackMax * (t[a] + u[b])  <= 2 * SlackMax);
+		xi_r_tt.add(xi_r_tt_l);
+		constraints.add(xi_r_tt_l - xi_r_l <= 0);
+		constraints.add(xi_r_tt_l - SlackMax * t[a] <= 0);
+		constraints.add(xi_r_tt_l - SlackMax * t[b] <= 0);
+		constraints.add(xi_r_l - xi_r_tt_l + SlackMax * (t[a] + t[b])  <= 2 * SlackMax);*/
+		IloNumVar xi_f_ut_l(environment, 0, SlackMax), xi_f_tt_l(environment, 0, SlackMax), xi_r_tu_l(environment, 0, SlackMax);
+		IloNumVar xi_r_tt_l(environment, 0, SlackMax), xi_f_uu_l(environment, 0, SlackMax), xi_f_tu_l(environment, 0, SlackMax);
+		xi_f_ut.add(xi_f_ut_l);
+		xi_f_tt.add(xi_f_tt_l);
+		xi_r_tu.add(xi_r_tu_l);
+		xi_r_tt.add(xi_r_tt_l);
+		xi_f_uu.add(xi_f_uu_l);
+		xi_f_tu.add(xi_f_tu_l);
+		constraints.add(xi_f_ut_l - xi_f_l <= 0);
+		constraints.add(xi_f_tt_l - xi_f_l <= 0);
+		constraints.add(xi_r_tu_l - xi_r_l <= 0);
+		constraints.add(xi_r_tt_l - xi_r_l <= 0);
+		constraints.add(xi_f_uu_l - xi_f_l <= 0);
+		constraints.add(xi_f_tu_l - xi_f_l <= 0);
+		constraints.add(xi_f_ut_l - SlackMax * u[a] <= 0);
+		constraints.add(xi_f_tt_l - SlackMax * t[a] <= 0);
+		constraints.add(xi_r_tu_l - SlackMax * t[a] <= 0);
+		constraints.add(xi_r_tt_l - SlackMax * t[a] <= 0);
+		constraints.add(xi_f_uu_l - SlackMax * u[a] <= 0);
+		constraints.add(xi_f_tu_l - SlackMax * t[a] <= 0);
+		constraints.add(xi_f_ut_l - SlackMax * t[b] <= 0);
+		constraints.add(xi_f_tt_l - SlackMax * t[b] <= 0);
+		constraints.add(xi_r_tu_l - SlackMax * u[b] <= 0);
+		constraints.add(xi_r_tt_l - SlackMax * t[b] <= 0);
+		constraints.add(xi_f_uu_l - SlackMax * u[b] <= 0);
+		constraints.add(xi_f_tu_l - SlackMax * u[b] <= 0);
+		constraints.add(xi_f_l - xi_f_ut_l + SlackMax * (u[a] + t[b]) <= 2 * SlackMax);
+		constraints.add(xi_f_l - xi_f_tt_l + SlackMax * (t[a] + t[b]) <= 2 * SlackMax);
+		constraints.add(xi_r_l - xi_r_tu_l + SlackMax * (t[a] + u[b]) <= 2 * SlackMax);
+		constraints.add(xi_r_l - xi_r_tt_l + SlackMax * (t[a] + t[b]) <= 2 * SlackMax);
+		constraints.add(xi_f_l - xi_f_uu_l + SlackMax * (u[a] + u[b]) <= 2 * SlackMax);
+		constraints.add(xi_f_l - xi_f_tu_l + SlackMax * (t[a] + u[b]) <= 2 * SlackMax);
+		if (!e)
+			h = h + w * (xi_f_ut_l - xi_f_tt_l + xi_r_tu_l - xi_r_tt_l);
+		else
+			h = h - w * (xi_f_ut_l - xi_f_tt_l - xi_r_tt_l) + w * (xi_f_uu_l - xi_f_tu_l);
+	}
+	catch (...)
+	{
+		return false;
+	}
+	return true;
+}
+
+bool MIQPSolver::appendOrderObjective(int a, int b, bool e, double w, const IloNumVar &delta_f_l, const IloNumVar &delta_r_l)
+{
+	try
+	{
+		IloNumVar delta_f_ut_l(environment, 0, SlackMax), delta_f_tt_l(environment, 0, SlackMax), delta_r_tu_l(environment, 0, SlackMax);
+		IloNumVar delta_r_tt_l(environment, 0, SlackMax), delta_f_uu_l(environment, 0, SlackMax), delta_f_tu_l(environment, 0, SlackMax);
+		delta_f_ut.add(delta_f_ut_l);
+		delta_f_tt.add(delta_f_tt_l);
+		delta_r_tu.add(delta_r_tu_l);
+		delta_r_tt.add(delta_r_tt_l);
+		delta_f_uu.add(delta_f_uu_l);
+		delta_f_tu.add(delta_f_tu_l);
+		constraints.add(delta_f_ut_l - delta_f_l <= 0);
+		constraints.add(delta_f_tt_l - delta_f_l <= 0);
+		constraints.add(delta_r_tu_l - delta_r_l <= 0);
+		constraints.add(delta_r_tt_l - delta_r_l <= 0);
+		constraints.add(delta_f_uu_l - delta_f_l <= 0);
+		constraints.add(delta_f_tu_l - delta_f_l <= 0);
+		constraints.add(delta_f_ut_l - SlackMax * u[a] <= 0);
+		constraints.add(delta_f_tt_l - SlackMax * t[a] <= 0);
+		constraints.add(delta_r_tu_l - SlackMax * t[a] <= 0);
+		constraints.add(delta_r_tt_l - SlackMax * t[a] <= 0);
+		constraints.add(delta_f_uu_l - SlackMax * u[a] <= 0);
+		constraints.add(delta_f_tu_l - SlackMax * t[a] <= 0);
+		constraints.add(delta_f_ut_l - SlackMax * t[b] <= 0);
+		constraints.add(delta_f_tt_l - SlackMax * t[b] <= 0);
+		constraints.add(delta_r_tu_l - SlackMax * u[b] <= 0);
+		constraints.add(delta_r_tt_l - SlackMax * t[b] <= 0);
+		constraints.add(delta_f_uu_l - SlackMax * u[b] <= 0);
+		constraints.add(delta_f_tu_l - SlackMax * u[b] <= 0);
+		constraints.add(delta_f_l - delta_f_ut_l + SlackMax * (u[a] + t[b]) <= 2 * SlackMax);
+		constraints.add(delta_f_l - delta_f_tt_l + SlackMax * (t[a] + t[b]) <= 2 * SlackMax);
+		constraints.add(delta_r_l - delta_r_tu_l + SlackMax * (t[a] + u[b]) <= 2 * SlackMax);
+		constraints.add(delta_r_l - delta_r_tt_l + SlackMax * (t[a] + t[b]) <= 2 * SlackMax);
+		constraints.add(delta_f_l - delta_f_uu_l + SlackMax * (u[a] + u[b]) <= 2 * SlackMax);
+		constraints.add(delta_f_l - delta_f_tu_l + SlackMax * (t[a] + u[b]) <= 2 * SlackMax);
+		if (!e)
+			p = p + w * (delta_f_ut_l - delta_f_tt_l + delta_r_tu_l - delta_r_tt_l);
+		else
+			p = p - w * (delta_f_ut_l - delta_f_tt_l - delta_r_tt_l) + w * (delta_f_uu_l - delta_f_tu_l);
+	}
+	catch (...)
+	{
+		return false;
+	}
+	return true;
+}
+
+bool MIQPSolver::addCoordinateConstraints(const vector<double> &coord)
+{
+	if ((int)coord.size() != ContigCount)
+		return false;
+	try
+	{
+		for (int i = 0; i < ContigCount; i++)
+			constraints.add(x[i] == coord[i]);
+	}
+	catch (...)
+	{
+		return false;
+	}
+	return true;
+}
+
+bool MIQPSolver::appendSizeObjective()
+{
+	try 
+	{
+		for (int i = 0; i < ContigCount; i++)
+			s = s + u[i];
+		s = s / ContigCount;
+	}
+	catch (...)
+	{
+		return false;
+	}
+	return true;
+}
+
+bool MIQPSolver::createModel()
+{
+	try
+	{
+		model.add(IloMaximize(environment, g - h - p + s));
+		model.add(constraints);
+		cplex = IloCplex(model);
+	}
+	catch (...)
+	{
+		return false;
+	}
+	return true;
+}
+
+void MIQPSolver::saveSolution()
+{
+	double minX = Helpers::Inf;
+	for (int i = 0; i < ContigCount; i++)
+	{
+		U[i] = cplex.getValue(u[i]) == 1;
+		T[i] = cplex.getValue(t[i]) == 1;
+		X[i] = (U[i] && optimized[i] ? cplex.getValue(x[i]) : 0);
+		if (U[i])
+			minX = min(minX, (T[i] == 1 ? X[i] - (len[i] == 0 ? 0 : len[i] - 1) : X[i]));
+	}
+	for (int i = 0; i < ContigCount; i++)
+		if (U[i]) X[i] -= minX;
+}